@@ -0,0 +1,139 @@
+// Compares TaskAssignmentStore with the std::map it replaced: inserting
+// assignments in random order, random point lookups, a full scan and a
+// per-employee scan.
+
+#include <QElapsedTimer>
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+#include "entities/task_assignment_store.h"
+
+namespace {
+
+using Key = std::tuple<int, int, int>;
+
+constexpr int kEmployees = 20000;
+constexpr int kProjects = 2000;
+constexpr int kTasksPerProject = 10;
+constexpr size_t kEntries = 160000;
+constexpr size_t kLookups = 1000000;
+
+double elapsedMs(const QElapsedTimer& timer) {
+    return static_cast<double>(timer.nsecsElapsed()) / 1e6;
+}
+
+std::vector<Key> makeKeys(std::mt19937& random) {
+    std::uniform_int_distribution<int> employee(1, kEmployees);
+    std::uniform_int_distribution<int> project(1, kProjects);
+    std::uniform_int_distribution<int> task(1, kTasksPerProject);
+
+    std::set<Key> unique;
+    while (unique.size() < kEntries) {
+        unique.emplace(employee(random), project(random), task(random));
+    }
+    std::vector<Key> keys(unique.begin(), unique.end());
+    std::ranges::shuffle(keys, random);
+    return keys;
+}
+
+void report(const char* label, double insertMs, double lookupMs,
+            double scanMs, double employeeScanMs, long long checksum) {
+    std::printf("%-6s insert: %8.2f ms  lookup: %8.2f ms  scan: %6.2f ms  "
+                "per-employee scan: %6.2f ms  (checksum %lld)\n",
+                label, insertMs, lookupMs, scanMs, employeeScanMs, checksum);
+}
+
+void runMap(const std::vector<Key>& keys, const std::vector<Key>& lookups) {
+    QElapsedTimer timer;
+    timer.start();
+    std::map<Key, int> assignments;
+    for (const auto& key : keys) {
+        assignments[key] = std::get<2>(key) + 1;
+    }
+    double insertMs = elapsedMs(timer);
+
+    long long checksum = 0;
+    timer.start();
+    for (const auto& key : lookups) {
+        if (auto it = assignments.find(key); it != assignments.end()) {
+            checksum += it->second;
+        }
+    }
+    double lookupMs = elapsedMs(timer);
+
+    timer.start();
+    for (const auto& [key, hours] : assignments) checksum += hours;
+    double scanMs = elapsedMs(timer);
+
+    // The map has no per-employee index: a range scan over the employee's
+    // leading key component is the best it can do.
+    timer.start();
+    for (int employeeId = 1; employeeId <= kEmployees; ++employeeId) {
+        for (auto it = assignments.lower_bound({employeeId, 0, 0});
+             it != assignments.end() && std::get<0>(it->first) == employeeId;
+             ++it) {
+            checksum += it->second;
+        }
+    }
+    double employeeScanMs = elapsedMs(timer);
+
+    report("map", insertMs, lookupMs, scanMs, employeeScanMs, checksum);
+}
+
+void runStore(const std::vector<Key>& keys, const std::vector<Key>& lookups) {
+    QElapsedTimer timer;
+    timer.start();
+    TaskAssignmentStore assignments;
+    for (const auto& [employeeId, projectId, taskId] : keys) {
+        assignments.set(employeeId, projectId, taskId, taskId + 1);
+    }
+    double insertMs = elapsedMs(timer);
+
+    long long checksum = 0;
+    timer.start();
+    for (const auto& [employeeId, projectId, taskId] : lookups) {
+        checksum += assignments.get(employeeId, projectId, taskId);
+    }
+    double lookupMs = elapsedMs(timer);
+
+    timer.start();
+    assignments.forEach(
+        [&checksum](int, int, int, int hours) { checksum += hours; });
+    double scanMs = elapsedMs(timer);
+
+    timer.start();
+    for (int employeeId = 1; employeeId <= kEmployees; ++employeeId) {
+        assignments.forEachOfEmployee(
+            employeeId, [&checksum](int, int, int hours) { checksum += hours; });
+    }
+    double employeeScanMs = elapsedMs(timer);
+
+    report("store", insertMs, lookupMs, scanMs, employeeScanMs, checksum);
+}
+
+}  // namespace
+
+int main() {
+    std::mt19937 random(7);
+    std::vector<Key> keys = makeKeys(random);
+
+    // Half the lookups hit, half miss.
+    std::vector<Key> lookups;
+    lookups.reserve(kLookups);
+    std::uniform_int_distribution<size_t> anyKey(0, keys.size() - 1);
+    for (size_t i = 0; i < kLookups; ++i) {
+        Key key = keys[anyKey(random)];
+        if (i % 2 == 1) std::get<2>(key) += kTasksPerProject;
+        lookups.push_back(key);
+    }
+
+    std::printf("%zu assignments, %zu lookups\n", keys.size(), lookups.size());
+    runMap(keys, lookups);
+    runStore(keys, lookups);
+    return 0;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <QDate>
+#include <QElapsedTimer>
+#include <QString>
+#include <memory>
+
+#include "entities/company.h"
+#include "entities/derived_employees.h"
+#include "entities/project.h"
+#include "entities/task.h"
+
+struct BenchmarkSize {
+    int employees;
+    int projects;
+    int tasksPerProject;
+    int assignments;
+};
+
+inline double elapsedMs(const QElapsedTimer& timer) {
+    return static_cast<double>(timer.nsecsElapsed()) / 1e6;
+}
+
+// A deterministic company of the given size. Every employee holds the same
+// number of assignments, each on a different project, so nobody exceeds
+// their weekly capacity.
+inline Company makeBenchmarkCompany(const BenchmarkSize& size) {
+    Company company("Benchmark", "Software", "Minsk", 2010);
+
+    for (int id = 1; id <= size.employees; ++id) {
+        company.addEmployee(std::make_shared<Developer>(
+            id, QString("Employee %1").arg(id), 2000.0 + id % 1000,
+            QString("Department %1").arg(id % 20), "C++", 3.0));
+    }
+
+    const QString description = "Benchmark project";
+    const QString phase = "Development";
+    const QString client = "Client";
+    const QDate startDate(2025, 1, 1);
+    const QDate endDate(2030, 12, 31);
+    for (int id = 1; id <= size.projects; ++id) {
+        QString name = QString("Project %1").arg(id);
+        company.addProject(Project(ProjectParams{id, name, description, phase,
+                                                 startDate, endDate, 1e7,
+                                                 client, 0}));
+        for (int taskId = 1; taskId <= size.tasksPerProject; ++taskId) {
+            company.addTaskToProject(
+                id, Task(taskId, QString("Task %1").arg(taskId), "Development",
+                         40, taskId % 5 + 1));
+        }
+    }
+
+    for (int index = 0; index < size.assignments; ++index) {
+        int employeeId = index % size.employees + 1;
+        int round = index / size.employees;
+        int projectId = (employeeId * 7919 + round) % size.projects + 1;
+        int taskId = (employeeId + round) % size.tasksPerProject + 1;
+        company.restoreTaskAssignment(employeeId, projectId, taskId, 4);
+    }
+
+    company.recalculateAllHours();
+    company.clearUnsavedChanges();
+    return company;
+}
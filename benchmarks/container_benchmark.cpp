@@ -0,0 +1,94 @@
+// Compares EmployeeContainer with the linear vector it replaced: random
+// find() calls and random remove() calls at several container sizes.
+
+#include <QElapsedTimer>
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "entities/company.h"
+#include "entities/derived_employees.h"
+
+namespace {
+
+// The container as it was before the id index: a scan on every lookup.
+class LinearEmployeeContainer {
+   public:
+    void add(std::shared_ptr<Employee> employee) {
+        employees.emplace_back(std::move(employee));
+    }
+
+    void remove(int employeeId) {
+        std::erase_if(employees, [employeeId](const auto& employee) {
+            return employee && employee->getId() == employeeId;
+        });
+    }
+
+    std::shared_ptr<Employee> find(int employeeId) const {
+        for (const auto& employee : employees) {
+            if (employee && employee->getId() == employeeId) return employee;
+        }
+        return nullptr;
+    }
+
+   private:
+    std::vector<std::shared_ptr<Employee>> employees;
+};
+
+constexpr int kLookups = 100000;
+constexpr int kRemovals = 1000;
+
+double elapsedMs(const QElapsedTimer& timer) {
+    return static_cast<double>(timer.nsecsElapsed()) / 1e6;
+}
+
+template <typename Container>
+void run(const char* label, int employeeCount) {
+    Container container;
+    for (int id = 1; id <= employeeCount; ++id) {
+        container.add(std::make_shared<Developer>(
+            id, QString("Employee %1").arg(id), 3000.0, "Engineering", "C++",
+            3.0));
+    }
+
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> anyId(1, employeeCount);
+    std::vector<int> lookups(kLookups);
+    std::ranges::generate(lookups, [&] { return anyId(random); });
+
+    std::vector<int> removals(static_cast<size_t>(employeeCount));
+    std::ranges::generate(removals, [id = 0]() mutable { return ++id; });
+    std::ranges::shuffle(removals, random);
+    removals.resize(std::min<size_t>(kRemovals, removals.size()));
+
+    QElapsedTimer timer;
+    timer.start();
+    int hits = 0;
+    for (int id : lookups) {
+        hits += container.find(id) != nullptr;
+    }
+    double findMs = elapsedMs(timer);
+
+    timer.start();
+    for (int id : removals) {
+        container.remove(id);
+    }
+    double removeMs = elapsedMs(timer);
+
+    std::printf("%-8s %7d employees  find x%d: %10.2f ms (%d hits)  "
+                "remove x%zu: %8.2f ms\n",
+                label, employeeCount, kLookups, findMs, hits, removals.size(),
+                removeMs);
+}
+
+}  // namespace
+
+int main() {
+    for (int employeeCount : {1000, 10000, 100000}) {
+        run<LinearEmployeeContainer>("linear", employeeCount);
+        run<EmployeeContainer>("indexed", employeeCount);
+    }
+    return 0;
+}
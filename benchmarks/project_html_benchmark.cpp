@@ -0,0 +1,52 @@
+// Times the project detail page: the first render, a render after an
+// unrelated model change, and a cached render. The project has 500 members
+// and 40 tasks in a 20,000-employee company.
+
+#include <cstdio>
+
+#include "benchmark_company.h"
+#include "helpers/html_generator.h"
+
+namespace {
+
+constexpr int kProjectId = 1;
+constexpr int kTeamSize = 500;
+constexpr int kCachedRenders = 1000;
+
+}  // namespace
+
+int main() {
+    Company company = makeBenchmarkCompany({20000, 200, 40, 20000});
+    for (int employeeId = 1; employeeId <= kTeamSize; ++employeeId) {
+        company.restoreTaskAssignment(employeeId, kProjectId,
+                                      employeeId % 40 + 1, 2);
+    }
+    company.recalculateAllHours();
+    const Project& project = *company.getProject(kProjectId);
+
+    QElapsedTimer timer;
+    timer.start();
+    QString firstHtml = HtmlGenerator::generateProjectDetailHtml(project, &company);
+    double firstMs = elapsedMs(timer);
+
+    // Touches an employee who is not on the project.
+    company.markEmployeeChanged(20000);
+    timer.start();
+    QString changedHtml =
+        HtmlGenerator::generateProjectDetailHtml(project, &company);
+    double changedMs = elapsedMs(timer);
+
+    timer.start();
+    qsizetype totalSize = 0;
+    for (int render = 0; render < kCachedRenders; ++render) {
+        totalSize +=
+            HtmlGenerator::generateProjectDetailHtml(project, &company).size();
+    }
+    double cachedMs = elapsedMs(timer) / kCachedRenders;
+
+    std::printf("first render:                 %8.3f ms\n", firstMs);
+    std::printf("after unrelated model change: %8.3f ms\n", changedMs);
+    std::printf("cached render:                %8.3f ms\n", cachedMs);
+    std::printf("page: %lld chars\n", static_cast<long long>(firstHtml.size()));
+    return firstHtml == changedHtml && totalSize > 0 ? 0 : 1;
+}
@@ -0,0 +1,76 @@
+// Times recalculateTaskAllocatedHours() against the projects x tasks x
+// employees loop it replaced, and checks both produce the same totals.
+// Pass a scale factor to grow the dataset; 1.0 is 50k employees, 5k
+// projects of 10 tasks and 100k assignments.
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "benchmark_company.h"
+#include "utils/company_utils.h"
+
+namespace {
+
+struct Totals {
+    long long hours = 0;
+    double cost = 0.0;
+};
+
+// The pre-index recalculation: every task asks every employee.
+Totals recalculateByScan(const Company& company) {
+    Totals totals;
+    auto employees = company.getAllEmployees();
+    for (const Project& project : company.getProjectsView()) {
+        for (const Task& task : project.getTasks()) {
+            for (const auto& employee : employees) {
+                if (!employee->isAssignedToProject(project.getId())) continue;
+                if (int hours = company.getEmployeeHours(
+                        employee->getId(), project.getId(), task.getId());
+                    hours > 0) {
+                    totals.hours += hours;
+                    totals.cost +=
+                        calculateEmployeeCost(employee->getSalary(), hours);
+                }
+            }
+        }
+    }
+    return totals;
+}
+
+Totals collectTotals(const Company& company) {
+    Totals totals;
+    for (const Project& project : company.getProjectsView()) {
+        totals.hours += project.getTasksAllocatedTotal();
+        totals.cost += project.getEmployeeCosts();
+    }
+    return totals;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    double scale = argc > 1 ? std::atof(argv[1]) : 0.1;
+    BenchmarkSize size{static_cast<int>(50000 * scale),
+                       static_cast<int>(5000 * scale), 10,
+                       static_cast<int>(100000 * scale)};
+    Company company = makeBenchmarkCompany(size);
+    std::printf("%d employees, %d projects x %d tasks, %d assignments\n",
+                size.employees, size.projects, size.tasksPerProject,
+                size.assignments);
+
+    QElapsedTimer timer;
+    timer.start();
+    Totals scanned = recalculateByScan(company);
+    double scanMs = elapsedMs(timer);
+
+    timer.start();
+    company.recalculateTaskAllocatedHours();
+    double indexedMs = elapsedMs(timer);
+    Totals indexed = collectTotals(company);
+
+    std::printf("scan:    %10.2f ms  (%lld h, cost %.2f)\n", scanMs,
+                scanned.hours, scanned.cost);
+    std::printf("indexed: %10.2f ms  (%lld h, cost %.2f)\n", indexedMs,
+                indexed.hours, indexed.cost);
+    return scanned.hours == indexed.hours ? 0 : 1;
+}
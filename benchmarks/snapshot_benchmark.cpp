@@ -0,0 +1,96 @@
+// Saves and loads one company as the four text files and as a binary
+// snapshot, and reports times and sizes. Pass a scale factor to grow the
+// dataset; 1.0 is 20k employees, 2k projects of 50 tasks and 74k
+// assignments.
+
+#include <QFileInfo>
+#include <QTemporaryDir>
+#include <cstdio>
+#include <cstdlib>
+
+#include "benchmark_company.h"
+#include "managers/company_snapshot.h"
+#include "managers/file_manager.h"
+
+namespace {
+
+struct TextFiles {
+    QString company;
+    QString employees;
+    QString projects;
+    QString tasks;
+    QString assignments;
+
+    qint64 totalSize() const {
+        return QFileInfo(company).size() + QFileInfo(employees).size() +
+               QFileInfo(projects).size() + QFileInfo(tasks).size() +
+               QFileInfo(assignments).size();
+    }
+};
+
+void saveText(const Company& company, const TextFiles& files) {
+    FileManager::saveCompany(company, files.company);
+    FileManager::saveEmployees(company, files.employees);
+    FileManager::saveProjects(company, files.projects);
+    FileManager::saveTasks(company, files.tasks);
+    FileManager::saveTaskAssignments(company, files.assignments);
+}
+
+Company loadText(const TextFiles& files) {
+    Company company = FileManager::loadCompany(files.company);
+    FileManager::loadEmployees(company, files.employees);
+    FileManager::loadProjects(company, files.projects);
+    FileManager::loadTasks(company, files.tasks);
+    FileManager::loadTaskAssignments(company, files.assignments);
+    return company;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    double scale = argc > 1 ? std::atof(argv[1]) : 1.0;
+    BenchmarkSize size{static_cast<int>(20000 * scale),
+                       static_cast<int>(2000 * scale), 50,
+                       static_cast<int>(74000 * scale)};
+    Company company = makeBenchmarkCompany(size);
+    std::printf("%d employees, %d projects x %d tasks, %d assignments\n",
+                size.employees, size.projects, size.tasksPerProject,
+                size.assignments);
+
+    QTemporaryDir dir;
+    TextFiles files{dir.filePath("company_1.txt"),
+                    dir.filePath("employees_1.txt"),
+                    dir.filePath("projects_1.txt"), dir.filePath("tasks_1.txt"),
+                    dir.filePath("task_assignments_1.txt")};
+    QString snapshotFile = dir.filePath("company_1.snap");
+
+    QElapsedTimer timer;
+    timer.start();
+    saveText(company, files);
+    double textSaveMs = elapsedMs(timer);
+
+    timer.start();
+    Company fromText = loadText(files);
+    double textLoadMs = elapsedMs(timer);
+
+    timer.start();
+    CompanySnapshot::save(company, snapshotFile);
+    double snapshotSaveMs = elapsedMs(timer);
+
+    timer.start();
+    Company fromSnapshot = CompanySnapshot::load(snapshotFile);
+    double snapshotLoadMs = elapsedMs(timer);
+
+    std::printf("%-9s %10s %10s %10s\n", "", "save", "load", "size");
+    std::printf("%-9s %7.1f ms %7.1f ms %7.2f MB\n", "text", textSaveMs,
+                textLoadMs, static_cast<double>(files.totalSize()) / 1e6);
+    std::printf("%-9s %7.1f ms %7.1f ms %7.2f MB\n", "snapshot",
+                snapshotSaveMs, snapshotLoadMs,
+                static_cast<double>(QFileInfo(snapshotFile).size()) / 1e6);
+
+    bool same = fromSnapshot.getAllTaskAssignments() ==
+                    company.getAllTaskAssignments() &&
+                fromText.getAllTaskAssignments() ==
+                    company.getAllTaskAssignments();
+    return same ? 0 : 1;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "entities/employee.h"
+#include "utils/sdlc_types.h"
+
+// Auto-assign candidates bucketed by employee type. Each bucket is a heap
+// ordered cheapest rate tier first, then by most remaining hours, so a task
+// only pays for the candidates it actually visits.
+class AssignmentCandidateIndex {
+   public:
+    struct Candidate {
+        std::shared_ptr<Employee> employee;
+        int rateTier;
+        int availableHours;
+    };
+
+    // Orders employees by type and hourly-rate tier. It reads no
+    // availability, so it can run before earlier placements finish.
+    static std::vector<Candidate> rankByRate(
+        const std::vector<std::shared_ptr<Employee>>& employees);
+
+    explicit AssignmentCandidateIndex(std::vector<Candidate> ranked);
+    explicit AssignmentCandidateIndex(
+        const std::vector<std::shared_ptr<Employee>>& employees);
+
+    std::optional<Candidate> popBest(EmployeeType type);
+    void push(Candidate candidate);
+
+    bool empty(EmployeeType type) const;
+    size_t size(EmployeeType type) const;
+
+   private:
+    std::array<std::vector<Candidate>, kEmployeeTypeCount> buckets;
+};
@@ -1,40 +1,61 @@
 #pragma once
 
 #include <QString>
+#include <cstdint>
 #include <exception>
 #include <map>
 #include <memory>
+#include <ranges>
+#include <span>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #include "entities/company_managers.h"
 #include "entities/derived_employees.h"
 #include "entities/employee.h"
+#include "entities/employee_search_index.h"
 #include "entities/project.h"
 #include "entities/task.h"
 #include "exceptions/exceptions.h"
 
+// Keeps employees in insertion order with an id-to-slot index. find() is a
+// hash lookup. The order is user-visible (tables and saved files follow
+// it), so remove() erases in place and renumbers every later entry rather
+// than swapping the last entry into the gap; it stays linear.
 class EmployeeContainer {
    private:
     std::vector<std::shared_ptr<Employee>> employees;
+    std::unordered_map<int, size_t> slotById;
+
+    void reindexFrom(size_t slot);
 
    public:
     void add(std::shared_ptr<Employee> employee);
+    // Puts a new object in the slot of the employee with the same id.
+    bool replace(std::shared_ptr<Employee> employee);
     void remove(int employeeId);
     std::shared_ptr<Employee> find(int employeeId) const;
     std::vector<std::shared_ptr<Employee>> getAll() const;
+    std::span<const std::shared_ptr<Employee>> view() const;
     size_t size() const;
 };
 
+// Same layout as EmployeeContainer, for projects.
 class ProjectContainer {
    private:
     std::vector<std::shared_ptr<Project>> projects;
+    std::unordered_map<int, size_t> slotById;
+
+    void reindexFrom(size_t slot);
 
    public:
     void add(std::shared_ptr<Project> project);
+    bool replace(std::shared_ptr<Project> project);
     void remove(int projectId);
     std::shared_ptr<Project> find(int projectId) const;
     std::vector<std::shared_ptr<Project>> getAll() const;
+    std::span<const std::shared_ptr<Project>> view() const;
     size_t size() const;
 };
 
@@ -47,14 +68,17 @@ class Company {
 
     EmployeeContainer employees;
     mutable ProjectContainer projects;
-    std::map<std::tuple<int, int, int>, int> taskAssignments;
+    TaskAssignmentStore taskAssignments;
 
     TaskAssignmentManager taskManager;
     mutable CompanyStatistics statistics;
+    // Built on the first search, then kept current by every employee change.
+    mutable std::shared_ptr<EmployeeSearchIndex> searchIndex;
 
    public:
     Company(QString name, QString industry, QString location, int foundedYear);
     Company(Company&& other) noexcept;
+    Company& operator=(Company&& other) noexcept;
 
     ~Company() noexcept;
 
@@ -68,15 +92,24 @@ class Company {
 
     void addEmployee(std::shared_ptr<Employee> employee);
     void removeEmployee(int employeeId);
+    // Same as removeEmployee followed by addEmployee, except that an
+    // existing employee keeps its position in the container.
+    void replaceEmployee(std::shared_ptr<Employee> employee);
     std::shared_ptr<Employee> getEmployee(int employeeId) const {
         return employees.find(employeeId);
     }
     std::vector<std::shared_ptr<Employee>> getAllEmployees() const {
         return employees.getAll();
     }
+    std::span<const std::shared_ptr<Employee>> getEmployeesView() const {
+        return employees.view();
+    }
+    std::shared_ptr<EmployeeSearchIndex> getEmployeeSearchIndex() const;
 
     void addProject(const Project& project);
     void removeProject(int projectId);
+    // Same as removeProject followed by addProject, keeping the position.
+    void replaceProject(const Project& project);
 
     Project* getProject(int projectId) const {
         if (std::shared_ptr<Project> result = projects.find(projectId);
@@ -102,10 +135,18 @@ class Company {
         }
         return projectList;
     }
+    auto getProjectsView() const {
+        return projects.view() |
+               std::views::transform(
+                   [](const std::shared_ptr<Project>& proj) -> const Project& {
+                       return *proj;
+                   });
+    }
 
-    void addTaskToProject(int projectId, const Task& task) const {
+    void addTaskToProject(int projectId, const Task& task) {
         if (std::shared_ptr<Project> proj = projects.find(projectId); proj) {
             proj->addTask(task);
+            taskManager.markProjectChanged(projectId);
             return;
         }
         throw CompanyException("Project not found");
@@ -114,6 +155,12 @@ class Company {
         return getProject(projectId) ? getProject(projectId)->getTasks()
                                      : std::vector<Task>();
     }
+    std::span<const Task> getProjectTasksView(int projectId) const {
+        if (const Project* proj = getProject(projectId); proj) {
+            return proj->getTasks();
+        }
+        return {};
+    }
 
     void assignEmployeeToTask(int employeeId, int projectId, int taskId,
                               int hours) {
@@ -125,6 +172,10 @@ class Company {
         getTaskManager().restoreTaskAssignment(employeeId, projectId, taskId,
                                                hours);
     }
+    void restoreTaskAssignments(int projectId, int taskId,
+                                std::span<const std::pair<int, int>> saved) {
+        getTaskManager().restoreTaskAssignments(projectId, taskId, saved);
+    }
     void removeEmployeeTaskAssignments(int employeeId) {
         getTaskManager().removeEmployeeTaskAssignments(employeeId);
     }
@@ -137,13 +188,41 @@ class Company {
     void fixTaskAssignmentsToCapacity() {
         getTaskManager().fixTaskAssignmentsToCapacity();
     }
+    LoadNormalization normalizeLoadedData() {
+        return getTaskManager().normalizeLoadedData();
+    }
+
+    void markEmployeeChanged(int employeeId);
+    void setChangeObserver(ModelChangeObserver observer) {
+        getTaskManager().setChangeObserver(std::move(observer));
+    }
+    void markProjectChanged(int projectId) {
+        getTaskManager().markProjectChanged(projectId);
+    }
+    void recalculateChanged(
+        RecalculationMode mode = RecalculationMode::Incremental) {
+        getTaskManager().recalculateChanged(mode);
+    }
+    std::uint64_t getModelVersion() const {
+        return taskManager.getModelVersion();
+    }
+    const UnsavedChanges& getUnsavedChanges() const {
+        return taskManager.getUnsavedChanges();
+    }
+    void clearUnsavedChanges() { getTaskManager().clearUnsavedChanges(); }
 
     void recalculateAllHours() {
         recalculateEmployeeHours();
         recalculateTaskAllocatedHours();
     }
-    void autoAssignEmployeesToProject(int projectId) {
-        getTaskManager().autoAssignEmployeesToProject(projectId);
+    void autoAssignEmployeesToProject(
+        int projectId, AutoAssignSolver solver = AutoAssignSolver::Greedy) {
+        getTaskManager().autoAssignEmployeesToProject(projectId, solver);
+    }
+    AutoAssignSummary autoAssignAllProjects(
+        AutoAssignOrder order = AutoAssignOrder::Priority,
+        AutoAssignSolver solver = AutoAssignSolver::Greedy) {
+        return getTaskManager().autoAssignAllProjects(order, solver);
     }
 
     int getEmployeeHours(int employeeId, int projectId, int taskId = -1) const {
@@ -158,6 +237,9 @@ class Company {
     std::map<std::tuple<int, int, int>, int> getAllTaskAssignments() const {
         return taskManager.getAllTaskAssignments();
     }
+    const TaskAssignmentStore& getAssignmentStore() const {
+        return taskManager.getAssignmentStore();
+    }
 
     int getEmployeeCount() const { return statistics.getEmployeeCount(); }
     int getProjectCount() const { return statistics.getProjectCount(); }
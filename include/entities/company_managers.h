@@ -1,36 +1,144 @@
 #pragma once
 
+#include <QString>
+#include <cstdint>
+#include <expected>
+#include <functional>
 #include <map>
 #include <memory>
+#include <span>
 #include <tuple>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "entities/employee.h"
 #include "entities/project.h"
+#include "entities/task_assignment_store.h"
 
 class EmployeeContainer;
 class ProjectContainer;
 
+enum class RecalculationMode { Incremental, Full, Verify };
+
+enum class AutoAssignOrder { Priority, Deadline, Budget };
+
+enum class AutoAssignSolver { Greedy, MinCostFlow };
+
+struct AutoAssignSummary {
+    std::vector<std::pair<int, int>> hoursByProject;
+    int totalHours = 0;
+};
+
+enum class AssignmentError {
+    EmployeeNotFound,
+    EmployeeInactive,
+    InvalidHours,
+    ProjectNotFound,
+    ProjectCompleted,
+    TaskNotFound,
+    TaskFullyAllocated,
+    NotEnoughHours,
+    OverBudget
+};
+
+// Why an assignment was rejected. The message is only formatted when
+// describe() is called, so callers that just check the code pay nothing.
+struct AssignmentFailure {
+    AssignmentError error;
+    int hours = 0;
+
+    QString describe() const;
+};
+
+// Projects whose allocated hours had no active employee assigned when the
+// company was loaded, with the hours that were cleared.
+struct LoadNormalization {
+    std::vector<std::pair<int, int>> clearedProjectHours;
+};
+
+// What the model layer reports when an entity or assignment is marked as
+// changed. AssignmentsChanged names both sides of the affected assignments.
+struct ModelChange {
+    enum class Kind { EmployeeChanged, ProjectChanged, AssignmentsChanged };
+
+    Kind kind;
+    int employeeId = -1;
+    int projectId = -1;
+};
+
+using ModelChangeObserver = std::function<void(const ModelChange&)>;
+
+// Entities touched since the last save. Unlike the recalculation sets it is
+// only cleared once the changes are persisted.
+struct UnsavedChanges {
+    std::unordered_set<int> employees;
+    std::unordered_set<int> projects;
+    bool everything = true;
+};
+
 class TaskAssignmentManager {
    private:
-    std::map<std::tuple<int, int, int>, int>& taskAssignments;
+    TaskAssignmentStore& taskAssignments;
     EmployeeContainer& employees;
     ProjectContainer& projects;
 
+    std::unordered_set<int> changedEmployees;
+    std::unordered_set<int> changedProjects;
+    bool fullRecalculationPending = true;
+    UnsavedChanges unsavedChanges;
+    ModelChangeObserver changeObserver;
+    std::uint64_t modelVersion;
+    int bulkLoadDepth = 0;
+
+    void notify(ModelChange::Kind kind, int employeeId, int projectId) const;
+    void markAssignmentChanged(int employeeId, int projectId);
+    void recalculateChangedOnly();
+    void recalculateEverything();
+    void clearChanges();
+
    public:
-    TaskAssignmentManager(std::map<std::tuple<int, int, int>, int>& assignments,
+    // Marks the whole company changed once when it ends instead of marking
+    // every restored assignment, which rescans the employee's assignments
+    // each time. Loaders hold one for as long as they fill the company.
+    class BulkLoad {
+       public:
+        explicit BulkLoad(TaskAssignmentManager& manager);
+        ~BulkLoad();
+        BulkLoad(const BulkLoad&) = delete;
+        BulkLoad& operator=(const BulkLoad&) = delete;
+
+       private:
+        TaskAssignmentManager& manager;
+    };
+
+    TaskAssignmentManager(TaskAssignmentStore& assignments,
                           EmployeeContainer& empContainer,
                           ProjectContainer& projContainer);
 
     void assignEmployeeToTask(int employeeId, int projectId, int taskId,
                               int hours);
+    // Returns the hours placed, which is less than requested when the task
+    // needs fewer.
+    std::expected<int, AssignmentFailure> tryAssignEmployeeToTask(
+        int employeeId, int projectId, int taskId, int hours);
     void restoreTaskAssignment(int employeeId, int projectId, int taskId,
                                int hours);
+    // Replays the saved (employee, hours) pairs of one task. A pair is
+    // placed like a new assignment when it still fits and restored as saved
+    // otherwise.
+    void restoreTaskAssignments(int projectId, int taskId,
+                                std::span<const std::pair<int, int>> saved);
     void removeEmployeeTaskAssignments(int employeeId);
     void recalculateEmployeeHours() const;
     void recalculateTaskAllocatedHours() const;
     void fixTaskAssignmentsToCapacity();
-    void autoAssignEmployeesToProject(int projectId);
+    LoadNormalization normalizeLoadedData();
+    void autoAssignEmployeesToProject(
+        int projectId, AutoAssignSolver solver = AutoAssignSolver::Greedy);
+    AutoAssignSummary autoAssignAllProjects(
+        AutoAssignOrder order = AutoAssignOrder::Priority,
+        AutoAssignSolver solver = AutoAssignSolver::Greedy);
     int getEmployeeProjectHours(int employeeId, int projectId) const;
     int getEmployeeTaskHours(int employeeId, int projectId, int taskId) const;
     void scaleEmployeeTaskAssignments(int employeeId, double scaleFactor);
@@ -41,6 +149,25 @@ class TaskAssignmentManager {
                            int hours);
     void removeTaskAssignment(int employeeId, int projectId, int taskId);
     std::map<std::tuple<int, int, int>, int> getAllTaskAssignments() const;
+    const TaskAssignmentStore& getAssignmentStore() const;
+
+    void markEmployeeChanged(int employeeId);
+    void markProjectChanged(int projectId);
+    void markAllChanged();
+    // The observer stays with this manager when the company is moved into.
+    void setChangeObserver(ModelChangeObserver observer);
+    // Carries the change tracking over when the owning company is moved.
+    void takeChangesFrom(TaskAssignmentManager& other);
+    bool hasPendingChanges() const;
+    // Changes whenever an entity is marked as changed or derived values are
+    // recalculated. Versions are never reused, not even by another company,
+    // so a version alone identifies the state a cached view was built from.
+    std::uint64_t getModelVersion() const { return modelVersion; }
+    void recalculateChanged(
+        RecalculationMode mode = RecalculationMode::Incremental);
+
+    const UnsavedChanges& getUnsavedChanges() const;
+    void clearUnsavedChanges();
 };
 
 class CompanyStatistics {
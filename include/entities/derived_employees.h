@@ -13,6 +13,7 @@ class Manager : public Employee {
             double employmentRate = 1.0);
 
     QString getEmployeeType() const override;
+    EmployeeType getTypeCode() const override;
     QString getDetails() const override;
     double calculateBonus() const override;
 
@@ -31,6 +32,7 @@ class Developer : public Employee {
               double developerYearsOfExperience, double employmentRate = 1.0);
 
     QString getEmployeeType() const override;
+    EmployeeType getTypeCode() const override;
     QString getDetails() const override;
     double calculateBonus() const override;
 
@@ -49,6 +51,7 @@ class Designer : public Employee {
              int designerNumberOfProjects, double employmentRate = 1.0);
 
     QString getEmployeeType() const override;
+    EmployeeType getTypeCode() const override;
     QString getDetails() const override;
     double calculateBonus() const override;
 
@@ -67,6 +70,7 @@ class QA : public Employee {
        double employmentRate = 1.0);
 
     QString getEmployeeType() const override;
+    EmployeeType getTypeCode() const override;
     QString getDetails() const override;
     double calculateBonus() const override;
 
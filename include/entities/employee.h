@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "exceptions/exceptions.h"
+#include "utils/sdlc_types.h"
 
 class Employee {
    private:
@@ -27,6 +28,7 @@ class Employee {
     virtual ~Employee() = default;
 
     virtual QString getEmployeeType() const = 0;
+    virtual EmployeeType getTypeCode() const = 0;
     virtual QString getDetails() const;
     virtual double calculateBonus() const = 0;
 
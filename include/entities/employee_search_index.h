@@ -0,0 +1,50 @@
+#pragma once
+
+#include <QString>
+#include <cstdint>
+#include <shared_mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "entities/employee.h"
+
+// Lowercased name, department and position of every employee, plus a
+// trigram posting list over that text. A query of three or more characters
+// only verifies the employees listed under its rarest trigram. The
+// constructor only copies the text; the postings are built by the first
+// such query, off the GUI thread. Updates come from the GUI thread while
+// searches may run on a pool thread, so every member function takes the
+// index lock.
+class EmployeeSearchIndex {
+   public:
+    explicit EmployeeSearchIndex(
+        std::span<const std::shared_ptr<Employee>> employees);
+
+    void add(const Employee& employee);
+    void remove(int employeeId);
+    void update(const Employee& employee);
+
+    // Ids of the employees whose name, department or position contains the
+    // term, ignoring case, in no particular order.
+    std::vector<int> search(const QString& term);
+
+   private:
+    using Trigram = std::uint64_t;
+
+    struct Entry {
+        QString text;
+        std::vector<Trigram> trigrams;
+    };
+
+    static std::vector<Trigram> trigramsOf(const QString& text);
+    void addLocked(const Employee& employee);
+    void removeLocked(int employeeId);
+    void buildPostingsLocked();
+    std::vector<int> searchLocked(const QString& lowercaseTerm) const;
+
+    std::shared_mutex mutex;
+    std::unordered_map<int, Entry> entries;
+    std::unordered_map<Trigram, std::vector<int>> postings;
+    bool postingsBuilt = false;
+};
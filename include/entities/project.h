@@ -7,6 +7,7 @@
 
 #include "entities/task.h"
 #include "exceptions/exceptions.h"
+#include "utils/sdlc_types.h"
 
 struct ProjectParams {
     int projectId;
@@ -26,6 +27,7 @@ class Project {
     QString name;
     QString description;
     QString phase;
+    ProjectPhase phaseCode;
     QDate startDate;
     QDate endDate;
     double budget;
@@ -42,6 +44,7 @@ class Project {
     QString getName() const;
     QString getDescription() const;
     QString getPhase() const;
+    ProjectPhase getPhaseCode() const;
     QDate getStartDate() const;
     QDate getEndDate() const;
     double getBudget() const;
@@ -4,12 +4,14 @@
 #include <QString>
 
 #include "exceptions/exceptions.h"
+#include "utils/sdlc_types.h"
 
 class Task {
    private:
     int id;
     QString name;
     QString type;
+    TaskType typeCode;
     int estimatedHours;
     int allocatedHours{0};
     int priority;
@@ -24,6 +26,7 @@ class Task {
     int getId() const;
     QString getName() const;
     QString getType() const;
+    TaskType getTypeCode() const;
     int getEstimatedHours() const;
     int getAllocatedHours() const;
     int getPriority() const;
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class TaskAssignmentStore {
+   public:
+    using Key = std::tuple<int, int, int>;
+    using PackedKey = std::uint64_t;
+
+    static constexpr int kIdBits = 21;
+    static constexpr int kMaxPackableId = (1 << kIdBits) - 1;
+
+    static bool canPack(int employeeId, int projectId, int taskId);
+    static PackedKey pack(int employeeId, int projectId, int taskId);
+    static Key unpack(PackedKey key);
+
+   private:
+    static constexpr PackedKey kEmptySlot = ~PackedKey{0};
+
+    std::vector<PackedKey> slotKeys;
+    std::vector<int> slotHours;
+    size_t count = 0;
+
+    // Sorted packed keys per employee and per project: one contiguous
+    // array per owner rather than a tree node per assignment.
+    std::unordered_map<int, std::vector<PackedKey>> byEmployee;
+    std::unordered_map<int, std::vector<PackedKey>> byProject;
+
+    size_t findSlot(PackedKey key) const;
+    void insertNew(PackedKey key, int hours);
+    void eraseSlot(size_t slot);
+    void rehash(size_t newCapacity);
+    void link(PackedKey key);
+    void unlink(PackedKey key);
+
+   public:
+    int get(int employeeId, int projectId, int taskId) const;
+    void set(int employeeId, int projectId, int taskId, int hours);
+    void add(int employeeId, int projectId, int taskId, int hours);
+    void erase(int employeeId, int projectId, int taskId);
+    void eraseEmployee(int employeeId);
+    void eraseProject(int projectId);
+    void clear();
+    void reserve(size_t expected);
+
+    size_t size() const;
+    bool empty() const;
+
+    int getEmployeeTotalHours(int employeeId) const;
+    int getEmployeeProjectHours(int employeeId, int projectId) const;
+    std::vector<std::pair<Key, int>> getOrderedEntries() const;
+
+    template <typename Fn>
+    void forEachOfEmployee(int employeeId, Fn&& fn) const {
+        auto it = byEmployee.find(employeeId);
+        if (it == byEmployee.end()) return;
+        for (PackedKey key : it->second) {
+            const auto& [empId, projectId, taskId] = unpack(key);
+            fn(projectId, taskId, slotHours[findSlot(key)]);
+        }
+    }
+
+    template <typename Fn>
+    void forEachOfProject(int projectId, Fn&& fn) const {
+        auto it = byProject.find(projectId);
+        if (it == byProject.end()) return;
+        for (PackedKey key : it->second) {
+            const auto& [employeeId, projId, taskId] = unpack(key);
+            fn(employeeId, taskId, slotHours[findSlot(key)]);
+        }
+    }
+
+    // Visits entries in slot order; use getOrderedEntries() when the
+    // caller needs (employee, project, task) order.
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        for (size_t slot = 0; slot < slotKeys.size(); ++slot) {
+            if (slotKeys[slot] == kEmptySlot) continue;
+            const auto& [employeeId, projectId, taskId] =
+                unpack(slotKeys[slot]);
+            fn(employeeId, projectId, taskId, slotHours[slot]);
+        }
+    }
+};
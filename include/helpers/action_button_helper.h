@@ -1,17 +1,16 @@
 #pragma once
 
-#include <QWidget>
-
-class QTableWidget;
+class QMenu;
+class QTableView;
 class MainWindow;
 
 class ActionButtonHelper {
    public:
-    static QWidget* createEmployeeActionButtons(QTableWidget* table,
-                                                int rowIndex,
-                                                MainWindow* mainWindow);
-    static QWidget* createProjectActionButtons(QTableWidget* table,
-                                               int rowIndex,
-                                               MainWindow* mainWindow,
-                                               bool includeAddTask = true);
+    static void populateEmployeeActions(QMenu* menu, MainWindow* mainWindow);
+    static void populateProjectActions(QMenu* menu, MainWindow* mainWindow,
+                                       bool includeAddTask = true);
+    static void installEmployeeActions(QTableView* table,
+                                       MainWindow* mainWindow);
+    static void installProjectActions(QTableView* table,
+                                      MainWindow* mainWindow);
 };
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <QTableWidget>
 #include <QTextEdit>
 #include <memory>
 #include <vector>
@@ -11,12 +10,6 @@ class MainWindow;
 
 class DisplayHelper {
    public:
-    static void displayEmployees(QTableWidget* employeeTable,
-                                 const Company* currentCompany,
-                                 MainWindow* mainWindow);
-    static void displayProjects(QTableWidget* projectTable,
-                                const Company* currentCompany,
-                                MainWindow* mainWindow);
     static void showCompanyInfo(QTextEdit* companyInfoText,
                                 const Company* currentCompany);
     static void showStatistics(QTextEdit* statisticsText,
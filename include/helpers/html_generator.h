@@ -7,10 +7,10 @@
 class Project;
 class Employee;
 class Company;
-class Task;
 
 class HtmlGenerator {
    public:
+    // Served from a cache until the company's model version changes.
     static QString generateProjectDetailHtml(const Project& project,
                                              const Company* company);
     static QString generateProjectAssignmentsHtml(const Project& project,
@@ -20,15 +20,13 @@ class HtmlGenerator {
         const std::vector<const Project*>& employeeProjects);
 
    private:
-    static QString generateTeamTableRow(
-        const std::shared_ptr<Employee>& employee, const Project& project,
-        const Company* company, const std::vector<Task>& tasks, int rowNumber,
-        bool projectCompleted);
+    static void appendTeamTableRow(QString& html, const Employee& employee,
+                                   const Project& project,
+                                   const Company* company,
+                                   const QString& tasksDisplay, int rowNumber,
+                                   bool projectCompleted);
     static QString formatPercentText(double value);
-    static QString getEmployeeStatus(const std::shared_ptr<Employee>& employee,
+    static QString getEmployeeStatus(const Employee& employee,
                                      const Project& project,
                                      bool projectCompleted);
-    static QString getEmployeeTasksDisplay(
-        const std::shared_ptr<Employee>& employee, const Project& project,
-        const Company* company, const std::vector<Task>& tasks);
 };
@@ -1,15 +1,52 @@
 #pragma once
 
 #include <QString>
+#include <QStringList>
+#include <cstddef>
+#include <string>
 #include <vector>
 
 class Company;
 
+enum class AutoSaveFormat { Snapshot, Text };
+
+// Bytes to write for one company. The snapshot image is empty when only
+// journal records are appended. Text files listed as superseded hold data
+// the snapshot now carries and are removed once it is written.
+struct CompanySaveJob {
+    QString snapshotFilePath;
+    QString journalFilePath;
+    std::vector<std::byte> snapshot;
+    std::string journalRecords;
+    QStringList supersededFilePaths;
+};
+
+// Everything an autosave writes, captured from the companies up front so the
+// files can be written while the companies keep changing.
+struct AutoSavePlan {
+    QString dataDirPath;
+    bool clearFiles = false;
+    std::vector<CompanySaveJob> jobs;
+    // Set when the save was abandoned before anything could be written.
+    QStringList errors;
+};
+
 class AutoSaveLoader {
    public:
     static QString getDataDirectory();
     static void autoSave(const std::vector<Company*>& companies,
-                         class MainWindow* mainWindow);
+                         class MainWindow* mainWindow,
+                         AutoSaveFormat format = AutoSaveFormat::Snapshot);
+    static AutoSavePlan captureChanges(const std::vector<Company*>& companies);
+    static QStringList writeChanges(const AutoSavePlan& plan);
+    static void discardPersistedState();
+    // Reads the employees and projects of a company that was loaded with
+    // only its company record. Throws FileManagerException on failure.
+    static void ensureLoaded(Company* company, class MainWindow* mainWindow);
+    // Reads every header-only company in full. Companies that fail to load
+    // stay header-only; returns whether all of them were read.
+    static bool ensureAllLoaded(const std::vector<Company*>& companies,
+                                class MainWindow* mainWindow);
     static void autoLoad(std::vector<Company*>& companies,
                          Company*& currentCompany, int& currentCompanyIndex,
                          class MainWindow* mainWindow);
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <QFutureWatcher>
+#include <QObject>
+#include <QStringList>
+#include <vector>
+
+class Company;
+
+// Runs autosaves off the GUI thread. The bytes to write are captured from
+// the companies on the GUI thread, then written by a pool thread. Requests
+// made while a save is running are coalesced into one follow-up save.
+class BackgroundAutoSaver : public QObject {
+    Q_OBJECT
+
+   public:
+    explicit BackgroundAutoSaver(const std::vector<Company*>& companies,
+                                 QObject* parent = nullptr);
+    ~BackgroundAutoSaver() override;
+
+    void requestSave();
+    void waitForFinished();
+    // Waits for the running save, then writes the latest state on the
+    // calling thread.
+    void flush();
+
+   signals:
+    void saveFailed(const QString& message);
+
+   private:
+    void startSave();
+    void collectResult();
+    void handleSaveFinished();
+
+    const std::vector<Company*>& companies;
+    QFutureWatcher<QStringList> watcher;
+    bool saveRunning = false;
+    bool savePending = false;
+};
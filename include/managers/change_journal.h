@@ -0,0 +1,24 @@
+#pragma once
+
+#include <QString>
+#include <cstdint>
+#include <string>
+
+#include "entities/company.h"
+
+// Append-only log kept next to a CompanySnapshot. Every record holds the
+// full current state of one employee or project (or its removal), so
+// replaying the records in order on top of the snapshot reproduces the
+// company as of the last append.
+class ChangeJournal {
+   public:
+    static constexpr std::uint32_t kFormatVersion = 1;
+
+    static void reset(const QString& fileName, std::uint64_t snapshotChecksum);
+    // Encodes the current state of every changed entity as journal records.
+    static std::string encode(const Company& company,
+                              const UnsavedChanges& changes);
+    static void append(const std::string& records, const QString& fileName);
+    static void replay(Company& company, const QString& fileName,
+                       std::uint64_t snapshotChecksum);
+};
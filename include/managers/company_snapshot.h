@@ -0,0 +1,31 @@
+#pragma once
+
+#include <QString>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "entities/company.h"
+
+// Versioned, checksummed binary image of a whole Company. Every entity kind
+// is stored as a section of fixed-width columns that refer into one shared
+// string table, so loading maps the file and reads values in place instead
+// of parsing text.
+class CompanySnapshot {
+   public:
+    static constexpr std::uint32_t kFormatVersion = 1;
+
+    // Builds the file image in memory without touching the disk.
+    static std::vector<std::byte> encode(const Company& company);
+    // Returns the payload checksum, which also identifies this snapshot.
+    static std::uint64_t write(std::span<const std::byte> image,
+                               const QString& fileName);
+    static std::uint64_t save(const Company& company, const QString& fileName);
+    // Derived totals such as weekly hours are left for
+    // Company::normalizeLoadedData.
+    static Company load(const QString& fileName);
+    // Reads only the company record, leaving employees and projects empty.
+    static Company loadHeader(const QString& fileName);
+    static std::uint64_t readChecksum(const QString& fileName);
+};
@@ -2,7 +2,6 @@
 
 #include <QString>
 #include <exception>
-#include <map>
 #include <memory>
 #include <vector>
 
@@ -34,8 +33,6 @@ class FileManager {
 
     static Company loadFromFile(const QString& fileName);
 
-    static std::map<int, bool> employeeStatusesFromFile;
-
    private:
     static int parseIntFromStream(std::ifstream& fileStream,
                                   const QString& fieldName);
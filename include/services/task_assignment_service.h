@@ -11,6 +11,7 @@
 #include "entities/task.h"
 #include "exceptions/exceptions.h"
 #include "services/cost_calculation_service.h"
+#include "utils/sdlc_types.h"
 
 class TaskAssignmentService {
    private:
@@ -32,6 +33,8 @@ class TaskAssignmentService {
     int getEmployeeProjectHours(int employeeId, int projectId) const;
     int getEmployeeTaskHours(int employeeId, int projectId, int taskId) const;
 
+    static bool roleMatchesSDLCStage(EmployeeType role,
+                                     ProjectPhase projectPhase);
     static bool roleMatchesSDLCStage(const QString& employeePosition,
                                      const QString& projectPhase);
     static bool taskTypeMatchesEmployeeType(const QString& taskType,
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <QPersistentModelIndex>
+#include <QStyledItemDelegate>
+#include <functional>
+
+class QAbstractItemView;
+class QMenu;
+
+// Paints an "Actions" push button in every cell of its column and pops up a
+// menu for the clicked row, so a table needs no per-row widgets.
+class ActionButtonDelegate : public QStyledItemDelegate {
+    Q_OBJECT
+
+   public:
+    using MenuBuilder = std::function<void(QMenu*)>;
+
+    ActionButtonDelegate(QAbstractItemView* view, MenuBuilder buildMenu);
+
+    void paint(QPainter* painter, const QStyleOptionViewItem& option,
+               const QModelIndex& index) const override;
+    QSize sizeHint(const QStyleOptionViewItem& option,
+                   const QModelIndex& index) const override;
+
+   protected:
+    bool editorEvent(QEvent* event, QAbstractItemModel* model,
+                     const QStyleOptionViewItem& option,
+                     const QModelIndex& index) override;
+
+   private:
+    static QRect buttonRect(const QRect& cell);
+    void showMenu(const QModelIndex& index, const QRect& button);
+
+    QAbstractItemView* view;
+    MenuBuilder buildMenu;
+    QPersistentModelIndex pressedIndex;
+};
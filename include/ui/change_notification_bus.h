@@ -0,0 +1,43 @@
+#pragma once
+
+#include <QObject>
+#include <QTimer>
+#include <unordered_set>
+
+#include "entities/company_managers.h"
+
+class Company;
+
+// Collects the ModelChange reports of the current company and publishes
+// them once per event-loop turn. Before publishing it brings the derived
+// hours and costs up to date, so subscribers only read settled values.
+class ChangeNotificationBus : public QObject {
+    Q_OBJECT
+
+   public:
+    explicit ChangeNotificationBus(QObject* parent = nullptr);
+
+    // Drops the pending changes, which the caller is about to reload anyway.
+    // Reports from any other company are ignored from now on.
+    void attach(Company* company);
+    // Publishes the pending changes now instead of on the next turn.
+    void flush();
+
+   signals:
+    void employeesChanged(const std::unordered_set<int>& employeeIds);
+    void projectsChanged(const std::unordered_set<int>& projectIds);
+    void assignmentsChanged(const std::unordered_set<int>& employeeIds,
+                            const std::unordered_set<int>& projectIds);
+    // Sent after the typed signals of a flush, for aggregate views.
+    void changesPublished();
+
+   private:
+    void post(const Company* source, const ModelChange& change);
+
+    Company* company = nullptr;
+    QTimer flushTimer;
+    std::unordered_set<int> changedEmployees;
+    std::unordered_set<int> changedProjects;
+    std::unordered_set<int> assignmentEmployees;
+    std::unordered_set<int> assignmentProjects;
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <QFutureWatcher>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <vector>
+
+class Company;
+class EntityFilterProxyModel;
+
+// Runs employee searches against the company's search index on a pool
+// thread. Keystrokes restart a short debounce timer; a query issued while
+// another is running replaces it, and only the latest result reaches the
+// filter proxy.
+class EmployeeSearchController : public QObject {
+    Q_OBJECT
+
+   public:
+    explicit EmployeeSearchController(EntityFilterProxyModel* proxy,
+                                      QObject* parent = nullptr);
+    ~EmployeeSearchController() override;
+
+    void requestSearch(const Company* company, const QString& term);
+    // Re-runs the current query at once, e.g. after the table was reloaded.
+    void refresh(const Company* company);
+
+   private:
+    void startSearch();
+    void handleSearchFinished();
+
+    EntityFilterProxyModel* proxy;
+    QTimer debounceTimer;
+    QFutureWatcher<std::vector<int>> watcher;
+    const Company* company = nullptr;
+    QString term;
+    bool searchRunning = false;
+    bool searchPending = false;
+};
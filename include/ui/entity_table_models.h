@@ -0,0 +1,104 @@
+#pragma once
+
+#include <QAbstractTableModel>
+#include <QSortFilterProxyModel>
+#include <QStringList>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class Company;
+
+// Table model whose rows are entity ids of one company. Cells are formatted
+// on demand, so only the rows the view actually paints are ever touched.
+// Replacing the row list emits row-level insert/remove signals when the new
+// list keeps the surviving rows in order, and a model reset otherwise.
+class EntityTableModel : public QAbstractTableModel {
+    Q_OBJECT
+
+   public:
+    static constexpr int IdRole = Qt::UserRole;
+
+    EntityTableModel(QStringList headers, QObject* parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index,
+                  int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+
+    void setCompany(const Company* rowCompany);
+    void setRows(const Company* rowCompany, std::vector<int> ids);
+    // Repaints the rows of the given ids. Reloads the row list instead when
+    // the company's entities or their order no longer match the rows.
+    void refreshEntities(const std::unordered_set<int>& ids);
+    int idAt(int row) const;
+    int rowOf(int id) const;
+    int actionColumn() const { return static_cast<int>(headers.size()) - 1; }
+
+   protected:
+    virtual std::vector<int> entityIds(const Company& rowCompany) const = 0;
+    virtual QVariant cellText(int id, int column) const = 0;
+    virtual QVariant cellForeground(int id) const;
+
+    const Company* company = nullptr;
+
+   private:
+    bool keepsSurvivorOrder(
+        const std::unordered_map<int, size_t>& positions) const;
+    void removeMissingRows(const std::unordered_map<int, size_t>& positions);
+    void insertNewRows(const std::vector<int>& ids);
+    void rebuildRowIndex();
+
+    QStringList headers;
+    std::vector<int> rowIds;
+    std::unordered_map<int, int> rowById;
+};
+
+class EmployeeTableModel : public EntityTableModel {
+    Q_OBJECT
+
+   public:
+    explicit EmployeeTableModel(QObject* parent = nullptr);
+
+   protected:
+    std::vector<int> entityIds(const Company& rowCompany) const override;
+    QVariant cellText(int id, int column) const override;
+    QVariant cellForeground(int id) const override;
+};
+
+class ProjectTableModel : public EntityTableModel {
+    Q_OBJECT
+
+   public:
+    explicit ProjectTableModel(QObject* parent = nullptr);
+
+   protected:
+    std::vector<int> entityIds(const Company& rowCompany) const override;
+    QVariant cellText(int id, int column) const override;
+};
+
+// Hides the rows of an entity model whose id is not in the current match
+// set. Without a match set every row is shown.
+class EntityFilterProxyModel : public QSortFilterProxyModel {
+    Q_OBJECT
+
+   public:
+    explicit EntityFilterProxyModel(EntityTableModel* source,
+                                    QObject* parent = nullptr);
+
+    void setMatchingIds(std::unordered_set<int> ids);
+    void clearMatchingIds();
+
+   protected:
+    bool filterAcceptsRow(int sourceRow,
+                          const QModelIndex& sourceParent) const override;
+
+   private:
+    void replaceMatchingIds(std::optional<std::unordered_set<int>> ids);
+
+    const EntityTableModel* entities;
+    std::optional<std::unordered_set<int>> matchingIds;
+};
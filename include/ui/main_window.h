@@ -27,8 +27,10 @@
 #include "helpers/employee_validator.h"
 #include "helpers/project_dialog_helper.h"
 #include "helpers/validation_helper.h"
+#include "managers/background_auto_saver.h"
 #include "managers/company_manager.h"
 #include "managers/file_manager.h"
+#include "ui/change_notification_bus.h"
 #include "ui/main_window_helpers.h"
 #include "ui/main_window_operations.h"
 #include "ui/main_window_ui_components.h"
@@ -68,13 +70,13 @@ class MainWindow : public QMainWindow {
     void autoLoad();
 
    public:
-    void validateAndFixProjectAssignments(const Company* company);
-
     QTabWidget* mainTabWidget = nullptr;
     EmployeeTabUI employeeUI;
     ProjectTabUI projectUI;
     StatisticsTabUI statisticsUI;
     CompanyUI companyUI;
+    BackgroundAutoSaver* autoSaver = nullptr;
+    ChangeNotificationBus* changeBus = nullptr;
 
     std::vector<Company*> companies{};
     Company* currentCompany = nullptr;
@@ -6,6 +6,7 @@
 #include <QTableWidget>
 #include <memory>
 #include <tuple>
+#include <unordered_set>
 #include <vector>
 
 #include "entities/company.h"
@@ -99,13 +100,21 @@ class MainWindowValidationHelper {
     static bool checkDuplicateProjectOnEdit(const QString& projectName,
                                             int excludeId,
                                             const Company* currentCompany);
-    static void validateAndFixProjectAssignments(MainWindow* window,
-                                                 const Company* company);
+    static void validateAndFixProjectAssignments(
+        MainWindow* window, const Company* company,
+        const std::unordered_set<int>& projectIds);
 };
 
 class MainWindowDataOperations {
    public:
     static void refreshAllData(MainWindow* window);
+    // Attaches the change bus to the current company and reloads every view
+    // of it.
+    static void showCurrentCompany(MainWindow* window);
+    static void connectChangeNotifications(MainWindow* window);
+    // Publishes the changes made so far instead of waiting for the next
+    // event-loop turn.
+    static void publishChanges(MainWindow* window);
     static void autoSave(MainWindow* window);
     static void autoLoad(MainWindow* window);
     static void selectProjectRowById(MainWindow* window, int projectId);
@@ -123,9 +132,8 @@ class MainWindowUIHelper {
                                  const QStringList& headers,
                                  const QList<int>& columnWidths,
                                  bool stretchLast = true);
-    static QWidget* createEmployeeActionButtons(MainWindow* window,
-                                                int rowIndex);
-    static QWidget* createProjectActionButtons(MainWindow* window,
-                                               int rowIndex);
+    static void setupTableView(QTableView* table,
+                               const QList<int>& columnWidths,
+                               bool stretchLast = true);
     static void selectProjectRowById(MainWindow* window, int projectId);
 };
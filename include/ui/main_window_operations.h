@@ -38,6 +38,7 @@ class ProjectOperations {
     static void addProjectTask(MainWindow* window);
     static void assignEmployeeToTask(MainWindow* window);
     static void autoAssignToProject(MainWindow* window, int projectId = -1);
+    static void autoAssignAllProjects(MainWindow* window);
     static void viewProjectAssignments(MainWindow* window);
     static void viewEmployeeHistory(MainWindow* window);
     static void showStatistics(MainWindow* window);
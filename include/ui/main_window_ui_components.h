@@ -4,13 +4,20 @@
 #include <QLabel>
 #include <QLineEdit>
 #include <QPushButton>
+#include <QTableView>
 #include <QTableWidget>
 #include <QTextEdit>
 #include <QWidget>
 
+#include "ui/employee_search_controller.h"
+#include "ui/entity_table_models.h"
+
 struct EmployeeTabUI {
     QWidget* tab = nullptr;
-    QTableWidget* table = nullptr;
+    QTableView* table = nullptr;
+    EmployeeTableModel* model = nullptr;
+    EntityFilterProxyModel* proxy = nullptr;
+    EmployeeSearchController* search = nullptr;
     QPushButton* addBtn = nullptr;
     QLineEdit* searchEdit = nullptr;
 };
@@ -20,9 +27,11 @@ struct ProjectTabUI {
     QWidget* listContainer = nullptr;
     QWidget* detailHeaderContainer = nullptr;
     QWidget* detailContainer = nullptr;
-    QTableWidget* table = nullptr;
+    QTableView* table = nullptr;
+    ProjectTableModel* model = nullptr;
     QTableWidget* tasksTable = nullptr;
     QPushButton* addBtn = nullptr;
+    QPushButton* autoAssignAllBtn = nullptr;
     QPushButton* detailCloseBtn = nullptr;
     QPushButton* detailAutoAssignBtn = nullptr;
     QLabel* detailTitle = nullptr;
@@ -1,10 +1,24 @@
 #pragma once
 
+#include <QColor>
+#include <QPixmap>
+#include <QSize>
+#include <QString>
 #include <QTimer>
 #include <QWidget>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 class Company;
 
+// Animated bar chart of the active employees' salaries. The sorted salaries
+// are read from the company only when its model version changes, and
+// everything that does not move during the animation is painted once into
+// a pixmap per widget size. Every employee keeps a bar, narrowing to one
+// pixel, until there are more employees than pixels; then neighbouring
+// salaries are merged into one bar per pixel column, so a frame never draws
+// more bars than the chart is wide.
 class StatisticsChartWidget : public QWidget {
     Q_OBJECT
 
@@ -16,13 +30,44 @@ class StatisticsChartWidget : public QWidget {
     void paintEvent(QPaintEvent* event) override;
 
    private:
-    void drawMainEmployeeSalaryChart(
-        class QPainter& painter, int width, int height,
-        const std::vector<std::pair<std::shared_ptr<class Employee>, double>>&
-            employeeData,
-        double progress) const;
+    struct SalaryEntry {
+        int employeeId;
+        QString name;
+        QString employeeType;
+        double salary;
+    };
+
+    struct Bar {
+        int x;
+        double salary;
+        QColor color;
+        QString name;
+        QString caption;
+    };
+
+    void rebuildChartData();
+    void rebuildLayout();
+    static Bar employeeBar(const SalaryEntry& entry, int x);
+    // One bar for salaries[first, last): their mean salary, coloured by the
+    // type most of them share.
+    Bar mergedBar(size_t first, size_t last, int x) const;
+    void paintStaticLayer(class QPainter& painter) const;
+    void drawBars(class QPainter& painter, double progress) const;
+    void drawLegend(class QPainter& painter) const;
 
     const Company* company = nullptr;
+    std::uint64_t dataVersion = 0;
+    // Active employees by ascending salary.
+    std::vector<SalaryEntry> salaries;
+    bool hasEmployees = false;
+    double totalSalaries = 0.0;
+    double maxSalary = 1.0;
+
+    QSize layoutSize;
+    std::vector<Bar> bars;
+    int barWidth = 0;
+    QPixmap staticLayer;
+
     QTimer* animationTimer = nullptr;
     double animationProgress = 0.0;
 };
@@ -11,6 +11,7 @@
 
 #include "entities/employee.h"
 #include "utils/consts.h"
+#include "utils/sdlc_types.h"
 
 inline double calculateHourlyRate(double monthlySalary) {
     if (kHoursPerMonth <= 0) return 0.0;
@@ -23,80 +24,18 @@ inline double calculateEmployeeCost(double monthlySalary, int hours) {
 
 inline bool roleMatchesSDLCStage(const QString& employeePosition,
                                  const QString& projectPhase) {
-    if (projectPhase == "Analysis" || projectPhase == "Planning") {
-        return employeePosition == "Manager";
-    }
-    if (projectPhase == "Design") {
-        return employeePosition == "Designer";
-    }
-    if (projectPhase == "Development") {
-        return employeePosition == "Developer";
-    }
-    if (projectPhase == "Testing") {
-        return employeePosition == "QA";
-    }
-    return true;
+    return roleMatchesSDLCStage(employeeTypeFromString(employeePosition),
+                                projectPhaseFromString(projectPhase));
 }
 
 inline bool taskTypeMatchesEmployeeType(const QString& taskType,
                                         const QString& employeeType) {
-    static const std::map<QString, QString> typeMapping = {
-        {"Management", "Manager"},
-        {"Development", "Developer"},
-        {"Design", "Designer"},
-        {"QA", "QA"}};
-    if (const auto& it = typeMapping.find(taskType); it != typeMapping.end()) {
-        return it->second == employeeType;
-    }
-    return false;
+    return taskTypeMatchesEmployeeType(taskTypeFromString(taskType),
+                                       employeeTypeFromString(employeeType));
 }
 
 inline QString getRequiredEmployeeType(const QString& taskType) {
-    static const std::map<QString, QString> typeMapping = {
-        {"Management", "Manager"},
-        {"Development", "Developer"},
-        {"Design", "Designer"},
-        {"QA", "QA"}};
-    if (const auto& it = typeMapping.find(taskType); it != typeMapping.end()) {
-        return it->second;
-    }
-    return "Unknown";
-}
-
-inline int compareEmployeesForSorting(const std::shared_ptr<Employee>& a,
-                                      const std::shared_ptr<Employee>& b,
-                                      const std::map<int, int>& employeeUsage) {
-    if (!a || !b) return 0;
-
-    double hourlyRateA = calculateHourlyRate(a->getSalary());
-    double hourlyRateB = calculateHourlyRate(b->getSalary());
-
-    int usedA = 0;
-    if (auto itA = employeeUsage.find(a->getId()); itA != employeeUsage.end()) {
-        usedA = itA->second;
-    }
-    int usedB = 0;
-    if (auto itB = employeeUsage.find(b->getId()); itB != employeeUsage.end()) {
-        usedB = itB->second;
-    }
-
-    int availA = a->getAvailableHours() - usedA;
-    int availB = b->getAvailableHours() - usedB;
-
-    double rateDiff = hourlyRateA - hourlyRateB;
-    if (rateDiff < -0.01) {
-        return -1;
-    }
-    if (rateDiff > 0.01) {
-        return 1;
-    }
-    if (availA > availB) {
-        return -1;
-    }
-    if (availA < availB) {
-        return 1;
-    }
-    return 0;
+    return toString(getRequiredEmployeeType(taskTypeFromString(taskType)));
 }
 
 inline void reduceExcessHours(
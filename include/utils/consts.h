@@ -18,6 +18,7 @@ inline const int kDefaultDialogMinWidth = 400;
 inline const int kAssignTaskDialogMinWidth = 450;
 inline const int kCompanySelectorMinWidth = 200;
 inline const int kSearchEditMinHeight = 35;
+inline const int kSearchDebounceMs = 150;
 inline const int kDateEditMinWidth = 200;
 inline const int kDescEditMaxHeight = 100;
 
@@ -42,6 +43,8 @@ inline const int kTableColumnWidth180 = 180;
 inline const int kTableColumnWidth200 = 200;
 
 inline const int kTableRowHeight = 50;
+inline const int kActionButtonWidth = 150;
+inline const int kActionButtonHeight = 38;
 
 inline const int kLayoutSpacing = 15;
 inline const int kLayoutMargins = 15;
@@ -61,18 +64,18 @@ inline const int kQaBugBonus = 100;
 
 inline const double kHoursPerMonth = 160.0;
 inline const double kMaxAffordableHourlyRateMultiplier = 0.7;
+inline const double kCostTolerance = 0.01;
 inline const int kHoursPerDay = 8;
 inline const int kMaxEmployees = 100000;
 inline const int kMaxProjects = 100000;
 inline const int kMaxTasks = 100000;
 inline const int kMaxSmallAssignments = 10000;
 inline const int kMaxLargeAssignments = 100000;
-inline const int kMaxLines = 1000000;
 inline const int kMaxAssignmentCount = 1000000;
 inline const int kMaxTasksSize = 1000000;
-inline const int kReserveCapacity = 10000;
 inline const int kMaxFileSizeMB = 100;
 inline const long long kMaxFileSizeBytes = 100LL * 1024 * 1024;
+inline const long long kJournalCompactionBytes = 4LL * 1024 * 1024;
 
 inline const int kEmployeeDialogHeightOffset = 227;
 inline const int kProjectsTableDialogWidth = 1400;
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// Successive-shortest-path min-cost max-flow over integer capacities and
+// non-negative integer costs.
+class MinCostFlow {
+   public:
+    struct Result {
+        int flow = 0;
+        std::int64_t cost = 0;
+    };
+
+    explicit MinCostFlow(int nodeCount);
+
+    int addEdge(int from, int to, int capacity, std::int64_t cost);
+
+    // Stops once the next unit of flow would push the total cost past
+    // costLimit, which gives the largest flow affordable within it.
+    Result solve(int source, int sink,
+                 std::int64_t costLimit =
+                     std::numeric_limits<std::int64_t>::max());
+
+    int getFlow(int edgeId) const;
+
+   private:
+    struct Edge {
+        int to;
+        int capacity;
+        std::int64_t cost;
+    };
+
+    std::vector<Edge> edges;
+    std::vector<int> initialCapacity;
+    std::vector<std::vector<int>> adjacency;
+
+    bool findShortestPath(int source, int sink,
+                          std::vector<std::int64_t>& potential,
+                          std::vector<int>& parentEdge) const;
+};
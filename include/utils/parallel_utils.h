@@ -0,0 +1,30 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// Runs fn(index) for every index in [0, count) on up to one thread per
+// core. fn must not throw and must only touch state owned by its index.
+template <typename Fn>
+void parallelFor(size_t count, Fn&& fn) {
+    size_t workerCount = std::min<size_t>(
+        count, std::max(1u, std::thread::hardware_concurrency()));
+    if (workerCount <= 1) {
+        for (size_t index = 0; index < count; ++index) fn(index);
+        return;
+    }
+
+    std::atomic<size_t> next{0};
+    std::vector<std::jthread> workers;
+    workers.reserve(workerCount);
+    for (size_t worker = 0; worker < workerCount; ++worker) {
+        workers.emplace_back([&next, &fn, count]() {
+            for (size_t index = next++; index < count; index = next++) {
+                fn(index);
+            }
+        });
+    }
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <QString>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+enum class ProjectPhase : std::uint8_t {
+    Analysis,
+    Planning,
+    Design,
+    Development,
+    Testing,
+    Deployment,
+    Maintenance,
+    Completed,
+    Unknown
+};
+
+enum class TaskType : std::uint8_t {
+    Management,
+    Development,
+    Design,
+    QA,
+    Unknown
+};
+
+enum class EmployeeType : std::uint8_t {
+    Manager,
+    Developer,
+    Designer,
+    QA,
+    Unknown
+};
+
+inline constexpr std::size_t kProjectPhaseCount =
+    static_cast<std::size_t>(ProjectPhase::Unknown) + 1;
+inline constexpr std::size_t kTaskTypeCount =
+    static_cast<std::size_t>(TaskType::Unknown) + 1;
+inline constexpr std::size_t kEmployeeTypeCount =
+    static_cast<std::size_t>(EmployeeType::Unknown) + 1;
+
+inline ProjectPhase projectPhaseFromString(const QString& phase) {
+    if (phase == "Analysis") return ProjectPhase::Analysis;
+    if (phase == "Planning") return ProjectPhase::Planning;
+    if (phase == "Design") return ProjectPhase::Design;
+    if (phase == "Development") return ProjectPhase::Development;
+    if (phase == "Testing") return ProjectPhase::Testing;
+    if (phase == "Deployment") return ProjectPhase::Deployment;
+    if (phase == "Maintenance") return ProjectPhase::Maintenance;
+    if (phase == "Completed") return ProjectPhase::Completed;
+    return ProjectPhase::Unknown;
+}
+
+inline TaskType taskTypeFromString(const QString& type) {
+    if (type == "Management") return TaskType::Management;
+    if (type == "Development") return TaskType::Development;
+    if (type == "Design") return TaskType::Design;
+    if (type == "QA") return TaskType::QA;
+    return TaskType::Unknown;
+}
+
+inline EmployeeType employeeTypeFromString(const QString& type) {
+    if (type == "Manager") return EmployeeType::Manager;
+    if (type == "Developer") return EmployeeType::Developer;
+    if (type == "Designer") return EmployeeType::Designer;
+    if (type == "QA") return EmployeeType::QA;
+    return EmployeeType::Unknown;
+}
+
+inline QString toString(EmployeeType type) {
+    switch (type) {
+        case EmployeeType::Manager:
+            return "Manager";
+        case EmployeeType::Developer:
+            return "Developer";
+        case EmployeeType::Designer:
+            return "Designer";
+        case EmployeeType::QA:
+            return "QA";
+        case EmployeeType::Unknown:
+            break;
+    }
+    return "Unknown";
+}
+
+constexpr int getPhaseOrder(ProjectPhase phase) {
+    return phase == ProjectPhase::Unknown ? -1 : static_cast<int>(phase);
+}
+
+constexpr bool isActivePhase(ProjectPhase phase) {
+    return phase != ProjectPhase::Completed && phase != ProjectPhase::Unknown;
+}
+
+constexpr EmployeeType getRequiredEmployeeType(TaskType type) {
+    switch (type) {
+        case TaskType::Management:
+            return EmployeeType::Manager;
+        case TaskType::Development:
+            return EmployeeType::Developer;
+        case TaskType::Design:
+            return EmployeeType::Designer;
+        case TaskType::QA:
+            return EmployeeType::QA;
+        case TaskType::Unknown:
+            break;
+    }
+    return EmployeeType::Unknown;
+}
+
+constexpr bool roleMatchesSDLCStage(EmployeeType role, ProjectPhase phase) {
+    switch (phase) {
+        case ProjectPhase::Analysis:
+        case ProjectPhase::Planning:
+            return role == EmployeeType::Manager;
+        case ProjectPhase::Design:
+            return role == EmployeeType::Designer;
+        case ProjectPhase::Development:
+            return role == EmployeeType::Developer;
+        case ProjectPhase::Testing:
+            return role == EmployeeType::QA;
+        default:
+            return true;
+    }
+}
+
+constexpr bool taskTypeMatchesEmployeeType(TaskType task, EmployeeType role) {
+    EmployeeType required = getRequiredEmployeeType(task);
+    return required != EmployeeType::Unknown && required == role;
+}
+
+using EligibilityTable = std::array<
+    std::array<std::array<bool, kTaskTypeCount>, kEmployeeTypeCount>,
+    kProjectPhaseCount>;
+
+inline constexpr EligibilityTable kAssignmentEligibility = [] {
+    EligibilityTable table{};
+    for (std::size_t phase = 0; phase < kProjectPhaseCount; ++phase) {
+        for (std::size_t role = 0; role < kEmployeeTypeCount; ++role) {
+            auto employeeType = static_cast<EmployeeType>(role);
+            bool roleFits = roleMatchesSDLCStage(
+                employeeType, static_cast<ProjectPhase>(phase));
+            for (std::size_t task = 0; task < kTaskTypeCount; ++task) {
+                table[phase][role][task] =
+                    roleFits && taskTypeMatchesEmployeeType(
+                                    static_cast<TaskType>(task), employeeType);
+            }
+        }
+    }
+    return table;
+}();
+
+constexpr bool isEligibleForTask(EmployeeType role, ProjectPhase phase,
+                                 TaskType task) {
+    return kAssignmentEligibility[static_cast<std::size_t>(phase)]
+                                 [static_cast<std::size_t>(role)]
+                                 [static_cast<std::size_t>(task)];
+}
+
+static_assert(isEligibleForTask(EmployeeType::Developer,
+                                ProjectPhase::Development,
+                                TaskType::Development));
+static_assert(!isEligibleForTask(EmployeeType::Designer,
+                                 ProjectPhase::Development,
+                                 TaskType::Design));
+static_assert(isEligibleForTask(EmployeeType::QA, ProjectPhase::Maintenance,
+                                TaskType::QA));
+static_assert(!isEligibleForTask(EmployeeType::Manager, ProjectPhase::Unknown,
+                                 TaskType::Unknown));
@@ -0,0 +1,106 @@
+#include "entities/assignment_candidate_index.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "utils/company_utils.h"
+#include "utils/consts.h"
+
+static bool isLowerPriority(const AssignmentCandidateIndex::Candidate& a,
+                            const AssignmentCandidateIndex::Candidate& b) {
+    if (a.rateTier != b.rateTier) return a.rateTier > b.rateTier;
+    if (a.availableHours != b.availableHours) {
+        return a.availableHours < b.availableHours;
+    }
+    return a.employee->getId() > b.employee->getId();
+}
+
+static size_t bucketIndex(EmployeeType type) {
+    return static_cast<size_t>(type);
+}
+
+static void assignRateTiers(
+    std::vector<AssignmentCandidateIndex::Candidate>& bucket) {
+    std::ranges::sort(bucket, [](const auto& a, const auto& b) {
+        return a.employee->getSalary() < b.employee->getSalary();
+    });
+
+    int tier = 0;
+    double tierRate = 0.0;
+    for (size_t i = 0; i < bucket.size(); ++i) {
+        double rate = calculateHourlyRate(bucket[i].employee->getSalary());
+        if (i == 0) {
+            tierRate = rate;
+        } else if (rate - tierRate > kCostTolerance) {
+            ++tier;
+            tierRate = rate;
+        }
+        bucket[i].rateTier = tier;
+    }
+}
+
+std::vector<AssignmentCandidateIndex::Candidate>
+AssignmentCandidateIndex::rankByRate(
+    const std::vector<std::shared_ptr<Employee>>& employees) {
+    std::array<std::vector<Candidate>, kEmployeeTypeCount> byType;
+    for (const auto& employee : employees) {
+        if (employee) {
+            byType[bucketIndex(employee->getTypeCode())].push_back(
+                {employee, 0, 0});
+        }
+    }
+
+    std::vector<Candidate> ranked;
+    ranked.reserve(employees.size());
+    for (auto& bucket : byType) {
+        assignRateTiers(bucket);
+        std::ranges::move(bucket, std::back_inserter(ranked));
+    }
+    return ranked;
+}
+
+AssignmentCandidateIndex::AssignmentCandidateIndex(
+    std::vector<Candidate> ranked) {
+    for (auto& candidate : ranked) {
+        candidate.availableHours = candidate.employee->getAvailableHours();
+        if (candidate.availableHours <= 0) continue;
+        buckets[bucketIndex(candidate.employee->getTypeCode())].push_back(
+            std::move(candidate));
+    }
+
+    for (auto& bucket : buckets) {
+        std::ranges::make_heap(bucket, isLowerPriority);
+    }
+}
+
+AssignmentCandidateIndex::AssignmentCandidateIndex(
+    const std::vector<std::shared_ptr<Employee>>& employees)
+    : AssignmentCandidateIndex(rankByRate(employees)) {}
+
+std::optional<AssignmentCandidateIndex::Candidate>
+AssignmentCandidateIndex::popBest(EmployeeType type) {
+    auto& bucket = buckets[bucketIndex(type)];
+    if (bucket.empty()) return std::nullopt;
+
+    std::ranges::pop_heap(bucket, isLowerPriority);
+    Candidate best = std::move(bucket.back());
+    bucket.pop_back();
+    return best;
+}
+
+void AssignmentCandidateIndex::push(Candidate candidate) {
+    if (!candidate.employee || candidate.availableHours <= 0) return;
+
+    auto& bucket = buckets[bucketIndex(candidate.employee->getTypeCode())];
+    bucket.push_back(std::move(candidate));
+    std::ranges::push_heap(bucket, isLowerPriority);
+}
+
+bool AssignmentCandidateIndex::empty(EmployeeType type) const {
+    return buckets[bucketIndex(type)].empty();
+}
+
+size_t AssignmentCandidateIndex::size(EmployeeType type) const {
+    return buckets[bucketIndex(type)].size();
+}
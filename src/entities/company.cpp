@@ -27,15 +27,6 @@ struct BuildEmployeePoolParams {
     const std::map<int, int>& employeeUsage;
 };
 
-struct AssignEmployeeToTaskParams {
-    int projectId;
-    int& remaining;
-    double& currentEmployeeCosts;
-    double& remainingBudget;
-    std::map<int, int>& employeeUsage;
-    std::map<std::tuple<int, int, int>, int>& taskAssignments;
-};
-
 static void buildActiveEmployeesList(
     const std::vector<std::shared_ptr<Employee>>& allEmployees,
     std::vector<std::shared_ptr<Employee>>& employeesList) {
@@ -156,38 +147,50 @@ static void validateBudgetConstraints(const std::shared_ptr<Employee>& employee,
     }
 }
 
-static bool matchesEmployeeId(const std::shared_ptr<Employee>& employee,
-                              int employeeId) {
-    return employee && employee->getId() == employeeId;
-}
-
-static bool matchesProjectId(const std::shared_ptr<Project>& project,
-                             int projectId) {
-    return project && project->getId() == projectId;
-}
-
 static bool isEmployeeActive(const std::shared_ptr<Employee>& employee) {
     return employee && employee->getIsActive();
 }
 
 void EmployeeContainer::add(std::shared_ptr<Employee> employee) {
-    if (employees.size() >= static_cast<size_t>(kMaxEmployees)) {
+    if (!employee || employees.size() >= static_cast<size_t>(kMaxEmployees)) {
         return;
     }
-    employees.emplace_back(employee);
+    if (slotById.contains(employee->getId())) {
+        return;
+    }
+    slotById.emplace(employee->getId(), employees.size());
+    employees.emplace_back(std::move(employee));
+}
+
+bool EmployeeContainer::replace(std::shared_ptr<Employee> employee) {
+    auto it = slotById.find(employee->getId());
+    if (it == slotById.end()) {
+        return false;
+    }
+    employees[it->second] = std::move(employee);
+    return true;
 }
 
 void EmployeeContainer::remove(int employeeId) {
-    std::erase_if(employees, [employeeId](const auto& emp) {
-        return matchesEmployeeId(emp, employeeId);
-    });
+    auto it = slotById.find(employeeId);
+    if (it == slotById.end()) {
+        return;
+    }
+    const size_t slot = it->second;
+    slotById.erase(it);
+    employees.erase(employees.begin() + static_cast<std::ptrdiff_t>(slot));
+    reindexFrom(slot);
+}
+
+void EmployeeContainer::reindexFrom(size_t slot) {
+    for (size_t i = slot; i < employees.size(); ++i) {
+        slotById[employees[i]->getId()] = i;
+    }
 }
 
 std::shared_ptr<Employee> EmployeeContainer::find(int employeeId) const {
-    for (const auto& emp : employees) {
-        if (matchesEmployeeId(emp, employeeId)) {
-            return emp;
-        }
+    if (auto it = slotById.find(employeeId); it != slotById.end()) {
+        return employees[it->second];
     }
     return nullptr;
 }
@@ -199,26 +202,55 @@ std::vector<std::shared_ptr<Employee>> EmployeeContainer::getAll() const {
     return employees;
 }
 
+std::span<const std::shared_ptr<Employee>> EmployeeContainer::view() const {
+    if (employees.size() > static_cast<size_t>(kMaxEmployees)) {
+        return {};
+    }
+    return employees;
+}
+
 size_t EmployeeContainer::size() const { return employees.size(); }
 
 void ProjectContainer::add(std::shared_ptr<Project> project) {
-    if (projects.size() >= static_cast<size_t>(kMaxProjects)) {
+    if (!project || projects.size() >= static_cast<size_t>(kMaxProjects)) {
+        return;
+    }
+    if (slotById.contains(project->getId())) {
         return;
     }
-    projects.emplace_back(project);
+    slotById.emplace(project->getId(), projects.size());
+    projects.emplace_back(std::move(project));
+}
+
+bool ProjectContainer::replace(std::shared_ptr<Project> project) {
+    auto it = slotById.find(project->getId());
+    if (it == slotById.end()) {
+        return false;
+    }
+    projects[it->second] = std::move(project);
+    return true;
 }
 
 void ProjectContainer::remove(int projectId) {
-    std::erase_if(projects, [projectId](const auto& proj) {
-        return matchesProjectId(proj, projectId);
-    });
+    auto it = slotById.find(projectId);
+    if (it == slotById.end()) {
+        return;
+    }
+    const size_t slot = it->second;
+    slotById.erase(it);
+    projects.erase(projects.begin() + static_cast<std::ptrdiff_t>(slot));
+    reindexFrom(slot);
+}
+
+void ProjectContainer::reindexFrom(size_t slot) {
+    for (size_t i = slot; i < projects.size(); ++i) {
+        slotById[projects[i]->getId()] = i;
+    }
 }
 
 std::shared_ptr<Project> ProjectContainer::find(int projectId) const {
-    for (const auto& proj : projects) {
-        if (matchesProjectId(proj, projectId)) {
-            return proj;
-        }
+    if (auto it = slotById.find(projectId); it != slotById.end()) {
+        return projects[it->second];
     }
     return nullptr;
 }
@@ -230,6 +262,13 @@ std::vector<std::shared_ptr<Project>> ProjectContainer::getAll() const {
     return projects;
 }
 
+std::span<const std::shared_ptr<Project>> ProjectContainer::view() const {
+    if (projects.size() > static_cast<size_t>(kMaxProjects)) {
+        return {};
+    }
+    return projects;
+}
+
 size_t ProjectContainer::size() const { return projects.size(); }
 
 Company::Company(QString companyName, QString companyIndustry,
@@ -250,7 +289,23 @@ Company::Company(Company&& other) noexcept
       projects(std::move(other.projects)),
       taskAssignments(std::move(other.taskAssignments)),
       taskManager(taskAssignments, employees, projects),
-      statistics(employees, projects) {}
+      statistics(employees, projects),
+      searchIndex(std::move(other.searchIndex)) {
+    taskManager.takeChangesFrom(other.taskManager);
+}
+
+Company& Company::operator=(Company&& other) noexcept {
+    name = std::move(other.name);
+    industry = std::move(other.industry);
+    location = std::move(other.location);
+    foundedYear = other.foundedYear;
+    employees = std::move(other.employees);
+    projects = std::move(other.projects);
+    taskAssignments = std::move(other.taskAssignments);
+    taskManager.takeChangesFrom(other.taskManager);
+    searchIndex = std::move(other.searchIndex);
+    return *this;
+}
 
 Company::~Company() noexcept { taskAssignments.clear(); }
 
@@ -259,42 +314,75 @@ void Company::addEmployee(std::shared_ptr<Employee> employee) {
         existing) {
         throw CompanyException("Employee with this ID already exists");
     }
-    employees.add(employee);
+    int employeeId = employee->getId();
+    if (searchIndex) searchIndex->add(*employee);
+    employees.add(std::move(employee));
+    taskManager.markEmployeeChanged(employeeId);
+}
+
+std::shared_ptr<EmployeeSearchIndex> Company::getEmployeeSearchIndex() const {
+    if (!searchIndex) {
+        searchIndex = std::make_shared<EmployeeSearchIndex>(employees.view());
+    }
+    return searchIndex;
+}
+
+void Company::markEmployeeChanged(int employeeId) {
+    if (searchIndex) {
+        if (std::shared_ptr<Employee> employee = employees.find(employeeId);
+            employee) {
+            searchIndex->update(*employee);
+        }
+    }
+    getTaskManager().markEmployeeChanged(employeeId);
 }
 
 static void removeEmployeeTaskAssignmentsFromProjects(
     int employeeId, const std::vector<int>& assignedProjects,
-    const ProjectContainer& projects, const Company& company,
-    std::map<std::tuple<int, int, int>, int>& taskAssignments) {
+    const ProjectContainer& projects, TaskAssignmentStore& taskAssignments) {
     for (int projectId : assignedProjects) {
         std::shared_ptr<Project> projPtr = projects.find(projectId);
         if (!projPtr) continue;
 
-        auto projectTasks = company.getProjectTasks(projectId);
-        for (const auto& task : projectTasks) {
-            auto key = std::make_tuple(employeeId, projectId, task.getId());
-            taskAssignments.erase(key);
+        for (const auto& task : projPtr->getTasks()) {
+            taskAssignments.erase(employeeId, projectId, task.getId());
         }
         projPtr->recomputeTotalsFromTasks();
     }
 }
 
 void Company::removeEmployee(int employeeId) {
+    taskManager.markEmployeeChanged(employeeId);
     if (std::shared_ptr<Employee> employee = employees.find(employeeId);
         employee) {
         const std::vector<int>& assignedProjects =
             employee->getAssignedProjects();
         removeEmployeeTaskAssignmentsFromProjects(
-            employeeId, assignedProjects, projects, *this, taskAssignments);
+            employeeId, assignedProjects, projects, taskAssignments);
     }
 
-    std::erase_if(taskAssignments, [employeeId](const auto& pair) {
-        const auto& [key, hours] = pair;
-        const auto& [empId, projectId, taskId] = key;
-        return empId == employeeId;
-    });
+    taskAssignments.eraseEmployee(employeeId);
 
     employees.remove(employeeId);
+    if (searchIndex) searchIndex->remove(employeeId);
+}
+
+void Company::replaceEmployee(std::shared_ptr<Employee> employee) {
+    int employeeId = employee->getId();
+    std::shared_ptr<Employee> existing = employees.find(employeeId);
+    if (!existing) {
+        addEmployee(std::move(employee));
+        return;
+    }
+
+    removeEmployeeTaskAssignmentsFromProjects(
+        employeeId, existing->getAssignedProjects(), projects,
+        taskAssignments);
+    taskAssignments.eraseEmployee(employeeId);
+
+    if (searchIndex) searchIndex->update(*employee);
+    employees.replace(std::move(employee));
+    taskManager.markEmployeeChanged(employeeId);
 }
 
 void Company::addProject(const Project& project) {
@@ -303,112 +391,22 @@ void Company::addProject(const Project& project) {
         throw CompanyException("Project with this ID already exists");
     }
     projects.add(std::make_shared<Project>(project));
+    taskManager.markProjectChanged(project.getId());
 }
 
 void Company::removeProject(int projectId) {
-    std::erase_if(taskAssignments, [projectId](const auto& pair) {
-        const auto& [key, hours] = pair;
-        const auto& [empId, projId, taskId] = key;
-        return projId == projectId;
-    });
+    taskManager.markProjectChanged(projectId);
+    taskAssignments.eraseProject(projectId);
     projects.remove(projectId);
 }
 
-static std::pair<int, double> calculateTaskAllocatedHours(
-    int projectId, int taskId,
-    const std::vector<std::shared_ptr<Employee>>& allEmployees,
-    const std::map<std::tuple<int, int, int>, int>& taskAssignments) {
-    int totalAllocated = 0;
-    double taskCost = 0.0;
-
-    for (const auto& employee : allEmployees) {
-        if (!employee || !employee->isAssignedToProject(projectId)) {
-            continue;
-        }
-
-        auto key = std::make_tuple(employee->getId(), projectId, taskId);
-        if (const auto assignmentIt = taskAssignments.find(key);
-            assignmentIt != taskAssignments.end()) {
-            const auto& [foundKey, hours] = *assignmentIt;
-            totalAllocated += hours;
-            taskCost += calculateEmployeeCost(employee->getSalary(), hours);
-        }
-    }
-
-    return {totalAllocated, taskCost};
-}
-
-static void updateTaskAssignmentsFromData(
-    int employeeId,
-    const std::vector<std::tuple<int, int, int, int>>& assignmentsData,
-    std::map<std::tuple<int, int, int>, int>& taskAssignments,
-    const ProjectContainer& projects,
-    const std::shared_ptr<Employee>& employee) {
-    for (const auto& assignment : assignmentsData) {
-        const auto& [projectId, taskId, oldHours, newHours] = assignment;
-        const auto key = std::make_tuple(employeeId, projectId, taskId);
-
-        if (newHours > 0) {
-            taskAssignments[key] = newHours;
-        } else {
-            taskAssignments.erase(key);
-        }
-
-        auto projPtr = projects.find(projectId);
-        updateTaskAndProjectCosts(projPtr, taskId, oldHours, newHours,
-                                  employee);
-    }
-}
-
-static void updateEmployeeHoursAfterScaling(
-    const std::shared_ptr<Employee>& employee,
-    const std::map<std::tuple<int, int, int>, int>& taskAssignments,
-    int employeeId) {
-    if (!employee->getIsActive()) {
+void Company::replaceProject(const Project& project) {
+    if (!projects.replace(std::make_shared<Project>(project))) {
+        addProject(project);
         return;
     }
-
-    const int currentCapacity = employee->getWeeklyHoursCapacity();
-
-    auto totalHours = 0;
-    for (const auto& [key, hours] : taskAssignments) {
-        const auto& [empId, projectId, taskId] = key;
-        if (empId == employeeId) {
-            totalHours += hours;
-        }
-    }
-
-    if (totalHours > currentCapacity) {
-        totalHours = currentCapacity;
-    }
-
-    if (int currentHours = employee->getCurrentWeeklyHours();
-        currentHours > 0) {
-        try {
-            employee->removeWeeklyHours(currentHours);
-        } catch (const EmployeeException& e) {
-            qCWarning(companyExceptions)
-                << "Failed to remove weekly hours:" << e.what();
-        }
-    }
-
-    if (totalHours > 0) {
-        try {
-            employee->addWeeklyHours(totalHours);
-        } catch (const EmployeeException& e) {
-            qCWarning(companyExceptions)
-                << "Failed to add weekly hours:" << e.what();
-        }
-
-        if (totalHours > currentCapacity) {
-            try {
-                employee->addWeeklyHours(currentCapacity);
-            } catch (const EmployeeException& e) {
-                qCWarning(companyExceptions)
-                    << "Failed to add weekly hours:" << e.what();
-            }
-        }
-    }
+    taskAssignments.eraseProject(project.getId());
+    taskManager.markProjectChanged(project.getId());
 }
 
 struct Assignment {
@@ -509,56 +507,6 @@ static void buildEmployeePool(const BuildEmployeePoolParams& params,
     }
 }
 
-static void assignEmployeeToTaskInPool(
-    const std::shared_ptr<Employee>& poolEmployee, Task& task,
-    AssignEmployeeToTaskParams& params) {
-    int employeeId = poolEmployee->getId();
-    int trulyAvailable = poolEmployee->getAvailableHours();
-    if (auto it = params.employeeUsage.find(employeeId);
-        it != params.employeeUsage.end()) {
-        const auto& [key, hours] = *it;
-        trulyAvailable -= hours;
-    }
-    if (trulyAvailable <= 0) return;
-
-    double hourlyRate = calculateHourlyRate(poolEmployee->getSalary());
-    int maxAffordableHours = 0;
-    if (hourlyRate > 0 && params.remainingBudget > 0) {
-        maxAffordableHours =
-            static_cast<int>(params.remainingBudget / hourlyRate);
-    }
-
-    int toAssign = params.remaining;
-    if (trulyAvailable < toAssign) {
-        toAssign = trulyAvailable;
-    }
-    if (maxAffordableHours < toAssign) {
-        toAssign = maxAffordableHours;
-    }
-    if (toAssign <= 0) return;
-
-    double assignmentCost =
-        calculateEmployeeCost(poolEmployee->getSalary(), toAssign);
-    double totalCost = params.currentEmployeeCosts + assignmentCost;
-    if (double projectBudget =
-            params.remainingBudget + params.currentEmployeeCosts;
-        totalCost > projectBudget) {
-        return;
-    }
-
-    poolEmployee->addWeeklyHours(toAssign);
-    poolEmployee->addAssignedProject(params.projectId);
-    task.addAllocatedHours(toAssign);
-    params.employeeUsage[employeeId] += toAssign;
-
-    const auto key =
-        std::make_tuple(employeeId, params.projectId, task.getId());
-    params.taskAssignments[key] += toAssign;
-    params.currentEmployeeCosts += assignmentCost;
-    params.remainingBudget -= assignmentCost;
-    params.remaining -= toAssign;
-}
-
 static void validateTaskAssignment(
     const std::shared_ptr<Employee>& employee,
     [[maybe_unused]] const std::shared_ptr<Project>& projPtr, const Task& task,
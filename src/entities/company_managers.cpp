@@ -2,13 +2,21 @@
 
 #include <QLoggingCategory>
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <ranges>
+#include <span>
 #include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
+#include "entities/assignment_candidate_index.h"
 #include "entities/company.h"
 #include "entities/employee.h"
 #include "entities/project.h"
@@ -17,19 +25,16 @@
 #include "utils/company_utils.h"
 #include "utils/consts.h"
 #include "utils/container_utils.h"
+#include "utils/min_cost_flow.h"
+#include "utils/parallel_utils.h"
 
 Q_LOGGING_CATEGORY(companyManagers, "company.managers")
 
-static std::vector<std::shared_ptr<Employee>> getActiveEmployees(
-    const EmployeeContainer& employees) {
-    std::vector<std::shared_ptr<Employee>> activeEmployees;
-    auto allEmployees = employees.getAll();
-    for (const auto& emp : allEmployees) {
-        if (emp && emp->getIsActive()) {
-            activeEmployees.emplace_back(emp);
-        }
-    }
-    return activeEmployees;
+static constexpr double kFlowCostScale = 10000.0;
+
+static std::uint64_t nextModelVersion() {
+    static std::atomic<std::uint64_t> lastVersion{0};
+    return ++lastVersion;
 }
 
 static bool isEmployeeAffordable(const std::shared_ptr<Employee>& employee,
@@ -48,46 +53,33 @@ static bool isEmployeeAffordable(const std::shared_ptr<Employee>& employee,
     return true;
 }
 
-static int getTrulyAvailableHours(const std::shared_ptr<Employee>& employee,
-                                  const std::map<int, int>& employeeUsage) {
-    int available = employee->getAvailableHours();
-    int employeeId = employee->getId();
-    if (auto it = employeeUsage.find(employeeId); it != employeeUsage.end()) {
-        available -= it->second;
-    }
-    return available;
+static double getMaxAffordableHourlyRate(const Project& project) {
+    int projectEstimatedHours = project.getInitialEstimatedHours();
+    if (projectEstimatedHours <= 0) return 0.0;
+    return project.getBudget() / static_cast<double>(projectEstimatedHours);
 }
 
-static std::vector<std::shared_ptr<Employee>> buildEmployeePool(
-    const std::vector<std::shared_ptr<Employee>>& activeEmployees,
-    const QString& projectPhase, const QString& taskType, double projectBudget,
-    double maxAffordableHourlyRate, int projectEstimatedHours,
-    const std::map<int, int>& employeeUsage) {
-    std::vector<std::shared_ptr<Employee>> pool;
-    for (const auto& employee : activeEmployees) {
-        if (!employee) continue;
-
-        if (QString pos = employee->getPosition();
-            !roleMatchesSDLCStage(pos, projectPhase))
-            continue;
-
-        if (QString employeeType = employee->getEmployeeType();
-            !taskTypeMatchesEmployeeType(taskType, employeeType))
-            continue;
-
-        if (!isEmployeeAffordable(employee, projectBudget,
-                                  maxAffordableHourlyRate,
-                                  projectEstimatedHours)) {
+static std::vector<std::shared_ptr<Employee>> collectAssignmentCandidates(
+    std::span<const std::shared_ptr<Employee>> employees,
+    const Project& project) {
+    ProjectPhase projectPhase = project.getPhaseCode();
+    double projectBudget = project.getBudget();
+    double maxAffordableHourlyRate = getMaxAffordableHourlyRate(project);
+    int projectEstimatedHours = project.getInitialEstimatedHours();
+
+    std::vector<std::shared_ptr<Employee>> candidates;
+    for (const auto& employee : employees) {
+        if (!employee || !employee->getIsActive()) continue;
+        if (!roleMatchesSDLCStage(employee->getTypeCode(), projectPhase)) {
             continue;
         }
-
-        if (int trulyAvailable =
-                getTrulyAvailableHours(employee, employeeUsage);
-            trulyAvailable > 0) {
-            pool.emplace_back(employee);
+        if (isEmployeeAffordable(employee, projectBudget,
+                                 maxAffordableHourlyRate,
+                                 projectEstimatedHours)) {
+            candidates.emplace_back(employee);
         }
     }
-    return pool;
+    return candidates;
 }
 
 static int calculateToAssignHours(int remaining, int trulyAvailable,
@@ -106,28 +98,22 @@ struct ProcessTaskAssignmentParams {
     Task& task;
     int projectId;
     double projectBudget;
-    const QString& projectPhase;
-    int projectEstimatedHours;
-    double maxAffordableHourlyRate;
-    const std::vector<std::shared_ptr<Employee>>& activeEmployees;
-    std::map<int, int>& employeeUsage;
-    std::map<std::tuple<int, int, int>, int>& taskAssignments;
+    ProjectPhase projectPhase;
+    AssignmentCandidateIndex& candidates;
+    TaskAssignmentStore& taskAssignments;
     double& currentEmployeeCosts;
     double& remainingBudget;
 };
 
 static void assignEmployeeToTask(
     const std::shared_ptr<Employee>& poolEmployee, Task& task, int projectId,
-    int toAssign, std::map<int, int>& employeeUsage,
-    std::map<std::tuple<int, int, int>, int>& taskAssignments) {
+    int toAssign, TaskAssignmentStore& taskAssignments) {
     int employeeId = poolEmployee->getId();
     poolEmployee->addWeeklyHours(toAssign);
     poolEmployee->addAssignedProject(projectId);
     task.addAllocatedHours(toAssign);
-    employeeUsage[employeeId] += toAssign;
 
-    const auto key = std::make_tuple(employeeId, projectId, task.getId());
-    taskAssignments[key] += toAssign;
+    taskAssignments.add(employeeId, projectId, task.getId(), toAssign);
 }
 
 static void processTaskAssignment(const ProcessTaskAssignmentParams& params) {
@@ -135,24 +121,23 @@ static void processTaskAssignment(const ProcessTaskAssignmentParams& params) {
         return;
     }
 
+    TaskType taskType = params.task.getTypeCode();
+    EmployeeType requiredType = getRequiredEmployeeType(taskType);
+    if (!isEligibleForTask(requiredType, params.projectPhase, taskType)) {
+        return;
+    }
+
     int remaining =
         params.task.getEstimatedHours() - params.task.getAllocatedHours();
-    QString taskType = params.task.getType();
+    std::vector<AssignmentCandidateIndex::Candidate> visited;
 
-    auto pool =
-        buildEmployeePool(params.activeEmployees, params.projectPhase, taskType,
-                          params.projectBudget, params.maxAffordableHourlyRate,
-                          params.projectEstimatedHours, params.employeeUsage);
+    while (remaining > 0) {
+        auto candidate = params.candidates.popBest(requiredType);
+        if (!candidate) break;
+        const auto& poolEmployee =
+            visited.emplace_back(std::move(*candidate)).employee;
 
-    std::ranges::sort(pool, [&params](const auto& a, const auto& b) {
-        return compareEmployeesForSorting(a, b, params.employeeUsage) < 0;
-    });
-
-    for (const auto& poolEmployee : pool) {
-        if (remaining <= 0) break;
-
-        int trulyAvailable =
-            getTrulyAvailableHours(poolEmployee, params.employeeUsage);
+        int trulyAvailable = poolEmployee->getAvailableHours();
         if (trulyAvailable <= 0) continue;
 
         double hourlyRate = calculateHourlyRate(poolEmployee->getSalary());
@@ -174,94 +159,263 @@ static void processTaskAssignment(const ProcessTaskAssignmentParams& params) {
         }
 
         assignEmployeeToTask(poolEmployee, params.task, params.projectId,
-                             toAssign, params.employeeUsage,
-                             params.taskAssignments);
+                             toAssign, params.taskAssignments);
         params.currentEmployeeCosts += assignmentCost;
         params.remainingBudget -= assignmentCost;
         remaining -= toAssign;
     }
+
+    for (auto& candidate : visited) {
+        candidate.availableHours = candidate.employee->getAvailableHours();
+        params.candidates.push(std::move(candidate));
+    }
 }
 
-static void resetEmployeeHours(const EmployeeContainer& employees) {
-    auto allEmployees = employees.getAll();
-    for (const auto& emp : allEmployees) {
-        if (emp) {
-            if (int currentHours = emp->getCurrentWeeklyHours();
-                currentHours > 0) {
-                try {
-                    emp->removeWeeklyHours(currentHours);
-                } catch (const EmployeeException& e) {
-                    qCWarning(companyManagers)
-                        << "Failed to remove weekly hours:" << e.what();
-                }
-            }
-        }
+static int placeProjectAssignmentsGreedily(
+    Project& project, AssignmentCandidateIndex& candidates,
+    TaskAssignmentStore& taskAssignments) {
+    int allocatedBefore = project.getTasksAllocatedTotal();
+    double projectBudget = project.getBudget();
+    double currentEmployeeCosts = 0.0;
+    double remainingBudget = projectBudget - project.getEmployeeCosts();
+
+    for (auto& task : project.getTasks()) {
+        ProcessTaskAssignmentParams params{task,
+                                           project.getId(),
+                                           projectBudget,
+                                           project.getPhaseCode(),
+                                           candidates,
+                                           taskAssignments,
+                                           currentEmployeeCosts,
+                                           remainingBudget};
+        processTaskAssignment(params);
     }
+    return project.getTasksAllocatedTotal() - allocatedBefore;
 }
 
-static void applyTaskAssignmentsToEmployees(
-    const std::map<std::tuple<int, int, int>, int>& taskAssignments,
-    const EmployeeContainer& employees) {
-    for (const auto& [key, hours] : taskAssignments) {
-        const auto& [employeeId, projectId, taskId] = key;
-        if (std::shared_ptr<Employee> employee = employees.find(employeeId);
-            employee && employee->getIsActive() && hours > 0) {
-            try {
-                employee->addWeeklyHours(hours);
-            } catch (const EmployeeException& e) {
-                qCWarning(companyManagers)
-                    << "Failed to add weekly hours:" << e.what();
-            }
+static std::int64_t toFlowCost(double hourlyRate) {
+    return static_cast<std::int64_t>(std::ceil(hourlyRate * kFlowCostScale));
+}
+
+// Employees feed tasks through edges priced at their hourly rate, so the
+// cheapest maximum flow within the remaining budget is the largest number
+// of hours the project can afford.
+static int placeProjectAssignmentsOptimally(
+    Project& project,
+    const std::vector<AssignmentCandidateIndex::Candidate>& ranked,
+    TaskAssignmentStore& taskAssignments) {
+    double remainingBudget = project.getBudget() - project.getEmployeeCosts();
+    auto budgetLimit =
+        static_cast<std::int64_t>(std::floor(remainingBudget * kFlowCostScale));
+    if (budgetLimit <= 0) return 0;
+
+    auto& tasks = project.getTasks();
+    const int source = 0;
+    const int sink = 1;
+    const int firstEmployeeNode = 2;
+    const int firstTaskNode =
+        firstEmployeeNode + static_cast<int>(ranked.size());
+    MinCostFlow flow(firstTaskNode + static_cast<int>(tasks.size()));
+
+    std::array<std::vector<int>, kEmployeeTypeCount> employeesByType;
+    for (size_t index = 0; index < ranked.size(); ++index) {
+        const auto& employee = ranked[index].employee;
+        int available = employee->getAvailableHours();
+        if (available <= 0) continue;
+        flow.addEdge(source, firstEmployeeNode + static_cast<int>(index),
+                     available, 0);
+        employeesByType[static_cast<size_t>(employee->getTypeCode())]
+            .push_back(static_cast<int>(index));
+    }
+
+    struct AssignmentEdge {
+        int employeeIndex;
+        size_t taskIndex;
+        int edgeId;
+    };
+    std::vector<AssignmentEdge> assignmentEdges;
+    ProjectPhase projectPhase = project.getPhaseCode();
+    for (size_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex) {
+        const Task& task = tasks[taskIndex];
+        int remaining = task.getEstimatedHours() - task.getAllocatedHours();
+        TaskType taskType = task.getTypeCode();
+        EmployeeType requiredType = getRequiredEmployeeType(taskType);
+        if (remaining <= 0 ||
+            !isEligibleForTask(requiredType, projectPhase, taskType)) {
+            continue;
+        }
+
+        int taskNode = firstTaskNode + static_cast<int>(taskIndex);
+        flow.addEdge(taskNode, sink, remaining, 0);
+        for (int employeeIndex :
+             employeesByType[static_cast<size_t>(requiredType)]) {
+            const auto& employee = ranked[employeeIndex].employee;
+            std::int64_t hourlyCost =
+                toFlowCost(calculateHourlyRate(employee->getSalary()));
+            int edgeId = flow.addEdge(firstEmployeeNode + employeeIndex,
+                                      taskNode, remaining, hourlyCost);
+            assignmentEdges.push_back({employeeIndex, taskIndex, edgeId});
         }
     }
-}
 
-static void clearProjectCosts(const ProjectContainer& projects) {
-    auto allProjects = projects.getAll();
-    for (const auto& proj : allProjects) {
-        if (!proj) continue;
-        if (double currentCosts = proj->getEmployeeCosts(); currentCosts > 0) {
-            proj->removeEmployeeCost(currentCosts);
+    int placed = flow.solve(source, sink, budgetLimit).flow;
+    for (const auto& [employeeIndex, taskIndex, edgeId] : assignmentEdges) {
+        if (int hours = flow.getFlow(edgeId); hours > 0) {
+            assignEmployeeToTask(ranked[employeeIndex].employee,
+                                 tasks[taskIndex], project.getId(), hours,
+                                 taskAssignments);
         }
     }
+    return placed;
 }
 
-static void calculateTaskAllocatedHoursForProject(
-    const std::shared_ptr<Project>& proj, const EmployeeContainer& employees,
-    const std::map<std::tuple<int, int, int>, int>& taskAssignments) {
-    auto projectId = proj->getId();
-    Project* mutableProj = proj.get();
-    auto& tasks = mutableProj->getTasks();
-    double projectTotalCosts = 0.0;
-
-    for (auto& task : tasks) {
-        auto taskId = task.getId();
-        int totalAllocated = 0;
-        double taskCost = 0.0;
-
-        auto allEmployees = employees.getAll();
-        for (const auto& employee : allEmployees) {
-            if (!employee || !employee->isAssignedToProject(projectId)) {
-                continue;
-            }
+static int placeProjectAssignments(
+    Project& project, std::vector<AssignmentCandidateIndex::Candidate> ranked,
+    AutoAssignSolver solver, TaskAssignmentStore& taskAssignments) {
+    if (solver == AutoAssignSolver::MinCostFlow) {
+        return placeProjectAssignmentsOptimally(project, ranked,
+                                                taskAssignments);
+    }
+    AssignmentCandidateIndex candidates(std::move(ranked));
+    return placeProjectAssignmentsGreedily(project, candidates,
+                                           taskAssignments);
+}
 
-            auto key = std::make_tuple(employee->getId(), projectId, taskId);
-            if (const auto assignmentIt = taskAssignments.find(key);
-                assignmentIt != taskAssignments.end()) {
-                totalAllocated += assignmentIt->second;
-                taskCost += calculateEmployeeCost(employee->getSalary(),
-                                                  assignmentIt->second);
-            }
+static int getHighestTaskPriority(const Project& project) {
+    int highest = 0;
+    for (const auto& task : project.getTasks()) {
+        highest = std::max(highest, task.getPriority());
+    }
+    return highest;
+}
+
+static void sortProjectsForAutoAssign(std::vector<Project*>& queue,
+                                      AutoAssignOrder order) {
+    auto byId = [](const Project* a, const Project* b) {
+        return a->getId() < b->getId();
+    };
+    switch (order) {
+        case AutoAssignOrder::Priority:
+            std::ranges::sort(queue, [&byId](const Project* a,
+                                             const Project* b) {
+                int priorityA = getHighestTaskPriority(*a);
+                int priorityB = getHighestTaskPriority(*b);
+                if (priorityA != priorityB) return priorityA > priorityB;
+                return byId(a, b);
+            });
+            break;
+        case AutoAssignOrder::Deadline:
+            std::ranges::sort(queue, [&byId](const Project* a,
+                                             const Project* b) {
+                QDate endA = a->getEndDate();
+                QDate endB = b->getEndDate();
+                if (endA.isNull() != endB.isNull()) return endB.isNull();
+                if (endA != endB) return endA < endB;
+                return byId(a, b);
+            });
+            break;
+        case AutoAssignOrder::Budget:
+            std::ranges::sort(queue, [&byId](const Project* a,
+                                             const Project* b) {
+                if (a->getBudget() != b->getBudget()) {
+                    return a->getBudget() > b->getBudget();
+                }
+                return byId(a, b);
+            });
+            break;
+    }
+}
+
+static void recalculateEmployeeWeeklyHours(
+    Employee& employee, const TaskAssignmentStore& taskAssignments) {
+    if (int currentHours = employee.getCurrentWeeklyHours();
+        currentHours > 0) {
+        try {
+            employee.removeWeeklyHours(currentHours);
+        } catch (const EmployeeException& e) {
+            qCWarning(companyManagers)
+                << "Failed to remove weekly hours:" << e.what();
+        }
+    }
+
+    if (!employee.getIsActive()) return;
+    int hours = taskAssignments.getEmployeeTotalHours(employee.getId());
+    if (hours <= 0) return;
+    try {
+        employee.addWeeklyHours(hours);
+    } catch (const EmployeeException& e) {
+        qCWarning(companyManagers)
+            << "Failed to add weekly hours:" << e.what();
+    }
+}
+
+// Per-task hours and costs of one project, summed from its assignments.
+class ProjectTaskTotals {
+   public:
+    explicit ProjectTaskTotals(const Project& project)
+        : allocatedBySlot(project.getTasks().size(), 0),
+          costBySlot(project.getTasks().size(), 0.0) {
+        const auto& tasks = project.getTasks();
+        slotByTaskId.reserve(tasks.size());
+        for (size_t slot = 0; slot < tasks.size(); ++slot) {
+            slotByTaskId.try_emplace(tasks[slot].getId(), slot);
         }
-        task.setAllocatedHours(totalAllocated);
-        projectTotalCosts += taskCost;
     }
 
-    if (projectTotalCosts > 0) {
-        mutableProj->addEmployeeCost(projectTotalCosts);
+    bool hasTask(int taskId) const { return slotByTaskId.contains(taskId); }
+
+    void add(int taskId, const Employee& employee, int hours) {
+        size_t slot = slotByTaskId.at(taskId);
+        allocatedBySlot[slot] += hours;
+        costBySlot[slot] += calculateEmployeeCost(employee.getSalary(), hours);
     }
 
-    mutableProj->recomputeTotalsFromTasks();
+    void applyTo(Project& project) const {
+        double projectTotalCosts = 0.0;
+        for (auto& task : project.getTasks()) {
+            size_t slot = slotByTaskId.at(task.getId());
+            task.setAllocatedHours(allocatedBySlot[slot]);
+            projectTotalCosts += costBySlot[slot];
+        }
+
+        if (double currentCosts = project.getEmployeeCosts();
+            currentCosts > 0) {
+            project.removeEmployeeCost(currentCosts);
+        }
+        if (projectTotalCosts > 0) {
+            project.addEmployeeCost(projectTotalCosts);
+        }
+
+        project.recomputeTotalsFromTasks();
+    }
+
+   private:
+    std::unordered_map<int, size_t> slotByTaskId;
+    std::vector<int> allocatedBySlot;
+    std::vector<double> costBySlot;
+};
+
+static void calculateTaskAllocatedHoursForProject(
+    Project& project, const EmployeeContainer& employees,
+    const TaskAssignmentStore& taskAssignments) {
+    auto projectId = project.getId();
+    ProjectTaskTotals totals(project);
+    taskAssignments.forEachOfProject(
+        projectId, [&](int employeeId, int taskId, int hours) {
+            if (!totals.hasTask(taskId) || hours <= 0) return;
+
+            std::shared_ptr<Employee> employee = employees.find(employeeId);
+            if (!employee || !employee->isAssignedToProject(projectId)) return;
+
+            totals.add(taskId, *employee, hours);
+        });
+    totals.applyTo(project);
+}
+
+static int scaleHoursToCapacity(int hours, int totalHours, int capacity) {
+    const auto scaleFactor = static_cast<double>(capacity) / totalHours;
+    auto newHours = static_cast<int>(std::round(hours * scaleFactor));
+    return std::max(0, std::min(newHours, capacity));
 }
 
 struct Assignment {
@@ -271,19 +425,6 @@ struct Assignment {
     size_t storageIndex;
 };
 
-static void collectEmployeeAssignments(
-    const std::map<std::tuple<int, int, int>, int>& taskAssignments,
-    std::map<int, std::vector<int>>& hoursStorage,
-    std::map<int, std::vector<Assignment>>& employeeAssignments) {
-    for (const auto& [key, hours] : taskAssignments) {
-        const auto& [employeeId, projectId, taskId] = key;
-        hoursStorage[employeeId].push_back(hours);
-        size_t index = hoursStorage[employeeId].size() - 1;
-        employeeAssignments[employeeId].emplace_back(projectId, taskId, hours,
-                                                     index);
-    }
-}
-
 static void scaleEmployeeAssignmentsToCapacity(
     std::map<int, std::vector<int>>& hoursStorage,
     const std::vector<Assignment>& assignments, int employeeId, int capacity) {
@@ -293,130 +434,203 @@ static void scaleEmployeeAssignmentsToCapacity(
     }
 
     if (totalHours > capacity && totalHours > 0) {
-        const auto scaleFactor = static_cast<double>(capacity) / totalHours;
         for (const auto& assignment : assignments) {
-            auto newHours =
-                static_cast<int>(std::round(assignment.oldHours * scaleFactor));
-            newHours = std::max(0, std::min(newHours, capacity));
             if (assignment.storageIndex < hoursStorage[employeeId].size()) {
-                hoursStorage[employeeId][assignment.storageIndex] = newHours;
+                hoursStorage[employeeId][assignment.storageIndex] =
+                    scaleHoursToCapacity(assignment.oldHours, totalHours,
+                                         capacity);
             }
         }
     }
 }
 
+static void updateTaskAssignmentsFromStorage(
+    const std::map<int, std::vector<int>>& hoursStorage,
+    const std::vector<Assignment>& assignments, int employeeId,
+    TaskAssignmentStore& taskAssignments) {
+    auto storageIt = hoursStorage.find(employeeId);
+    if (storageIt == hoursStorage.end()) {
+        return;
+    }
+    const auto& employeeStorage = storageIt->second;
+    for (const auto& assignment : assignments) {
+        if (assignment.storageIndex < employeeStorage.size()) {
+            taskAssignments.set(employeeId, assignment.projectId,
+                                assignment.taskId,
+                                employeeStorage[assignment.storageIndex]);
+        }
+    }
+}
+
+static void fitEmployeeAssignmentsToCapacity(
+    const Employee& employee, TaskAssignmentStore& taskAssignments) {
+    int employeeId = employee.getId();
+    std::map<int, std::vector<int>> hoursStorage;
+    std::vector<Assignment> assignments;
+    taskAssignments.forEachOfEmployee(
+        employeeId, [&](int projectId, int taskId, int hours) {
+            auto& employeeStorage = hoursStorage[employeeId];
+            employeeStorage.push_back(hours);
+            assignments.emplace_back(projectId, taskId, hours,
+                                     employeeStorage.size() - 1);
+        });
+    if (assignments.empty()) return;
+
+    scaleEmployeeAssignmentsToCapacity(hoursStorage, assignments, employeeId,
+                                       employee.getWeeklyHoursCapacity());
+    updateTaskAssignmentsFromStorage(hoursStorage, assignments, employeeId,
+                                     taskAssignments);
+}
+
 static void collectScaledAssignments(
-    const std::map<std::tuple<int, int, int>, int>& taskAssignments,
-    int employeeId, double scaleFactor,
+    const TaskAssignmentStore& taskAssignments, int employeeId,
+    double scaleFactor,
     std::vector<std::tuple<int, int, int, int>>& assignmentsData,
     int& totalScaledHours) {
-    for (const auto& [key, oldHours] : taskAssignments) {
-        const auto& [empId, projectId, taskId] = key;
-        if (empId != employeeId) {
-            continue;
-        }
-        auto scaledHours = static_cast<int>(std::round(oldHours * scaleFactor));
-        if (scaledHours < 0) {
-            scaledHours = 0;
-        }
-        assignmentsData.emplace_back(projectId, taskId, oldHours, scaledHours);
-        totalScaledHours += scaledHours;
-    }
+    taskAssignments.forEachOfEmployee(
+        employeeId, [&](int projectId, int taskId, int oldHours) {
+            auto scaledHours =
+                static_cast<int>(std::round(oldHours * scaleFactor));
+            if (scaledHours < 0) {
+                scaledHours = 0;
+            }
+            assignmentsData.emplace_back(projectId, taskId, oldHours,
+                                         scaledHours);
+            totalScaledHours += scaledHours;
+        });
 }
 
 static void applyScaledAssignments(
     const std::vector<std::tuple<int, int, int, int>>& assignmentsData,
-    int employeeId, std::map<std::tuple<int, int, int>, int>& taskAssignments) {
+    int employeeId, TaskAssignmentStore& taskAssignments) {
     for (const auto& assignment : assignmentsData) {
         const auto& [projectId, taskId, oldHours, newHours] = assignment;
-        const auto key = std::make_tuple(employeeId, projectId, taskId);
-
-        if (newHours > 0) {
-            taskAssignments[key] = newHours;
-        } else {
-            taskAssignments.erase(key);
-        }
+        taskAssignments.set(employeeId, projectId, taskId, newHours);
     }
 }
 
-TaskAssignmentManager::TaskAssignmentManager(
-    std::map<std::tuple<int, int, int>, int>& assignments,
-    EmployeeContainer& empContainer, ProjectContainer& projContainer)
+TaskAssignmentManager::TaskAssignmentManager(TaskAssignmentStore& assignments,
+                                             EmployeeContainer& empContainer,
+                                             ProjectContainer& projContainer)
     : taskAssignments(assignments),
       employees(empContainer),
-      projects(projContainer) {}
+      projects(projContainer),
+      modelVersion(nextModelVersion()) {}
+
+TaskAssignmentManager::BulkLoad::BulkLoad(TaskAssignmentManager& manager)
+    : manager(manager) {
+    ++manager.bulkLoadDepth;
+}
+
+TaskAssignmentManager::BulkLoad::~BulkLoad() {
+    if (--manager.bulkLoadDepth == 0) {
+        manager.markAllChanged();
+    }
+}
 
 CompanyStatistics::CompanyStatistics(const EmployeeContainer& empContainer,
                                      const ProjectContainer& projContainer)
     : employees(empContainer), projects(projContainer) {}
 
+QString AssignmentFailure::describe() const {
+    switch (error) {
+        case AssignmentError::EmployeeNotFound:
+            return "Employee not found";
+        case AssignmentError::EmployeeInactive:
+            return "Cannot assign inactive employee";
+        case AssignmentError::InvalidHours:
+            return QString("Hours must be between 1 and %1 (week maximum)")
+                .arg(kMaxHoursPerWeek);
+        case AssignmentError::ProjectNotFound:
+            return "Project not found";
+        case AssignmentError::ProjectCompleted:
+            return "Cannot assign to project with phase: Completed";
+        case AssignmentError::TaskNotFound:
+            return "Task not found";
+        case AssignmentError::TaskFullyAllocated:
+            return "Task already fully allocated";
+        case AssignmentError::NotEnoughHours:
+            return QString("Not enough available hours to assign %1 hours")
+                .arg(hours);
+        case AssignmentError::OverBudget:
+            return "Assignment would exceed project budget";
+    }
+    return {};
+}
+
 void TaskAssignmentManager::assignEmployeeToTask(int employeeId, int projectId,
                                                  int taskId, int hours) {
+    if (auto placed =
+            tryAssignEmployeeToTask(employeeId, projectId, taskId, hours);
+        !placed) {
+        throw CompanyException(placed.error().describe());
+    }
+}
+
+std::expected<int, AssignmentFailure>
+TaskAssignmentManager::tryAssignEmployeeToTask(int employeeId, int projectId,
+                                               int taskId, int hours) {
     std::shared_ptr<Employee> employee = employees.find(employeeId);
-    if (!employee) throw CompanyException("Employee not found");
-    if (!employee->getIsActive())
-        throw CompanyException("Cannot assign inactive employee");
+    if (!employee) {
+        return std::unexpected(
+            AssignmentFailure{AssignmentError::EmployeeNotFound});
+    }
+    if (!employee->getIsActive()) {
+        return std::unexpected(
+            AssignmentFailure{AssignmentError::EmployeeInactive});
+    }
 
     SafeValue safeHours(hours, 1, kMaxHoursPerWeek);
     if (!safeHours.isValidValue()) {
-        throw CompanyException(
-            QString("Hours must be between 1 and %1 (week maximum)")
-                .arg(kMaxHoursPerWeek));
+        return std::unexpected(
+            AssignmentFailure{AssignmentError::InvalidHours});
     }
     hours = safeHours.getValue();
 
     std::shared_ptr<Project> projPtr = projects.find(projectId);
-    if (!projPtr) throw CompanyException("Project not found");
-
-    if (QString projectPhase = projPtr->getPhase();
-        projectPhase == "Completed") {
-        throw CompanyException("Cannot assign to project with phase: " +
-                               projectPhase);
+    if (!projPtr) {
+        return std::unexpected(
+            AssignmentFailure{AssignmentError::ProjectNotFound});
+    }
+    if (projPtr->getPhaseCode() == ProjectPhase::Completed) {
+        return std::unexpected(
+            AssignmentFailure{AssignmentError::ProjectCompleted});
     }
 
     std::vector<Task>& tasks = projPtr->getTasks();
-    bool found = false;
-    for (auto& task : tasks) {
-        if (task.getId() == taskId) {
-            auto key = std::make_tuple(employeeId, projectId, taskId);
-
-            auto needed = task.getEstimatedHours() - task.getAllocatedHours();
-            if (needed <= 0) {
-                throw CompanyException("Task already fully allocated");
-            }
-
-            int toAssign = std::min(needed, hours);
-            if (toAssign <= 0) {
-                return;
-            }
+    auto task = std::ranges::find(tasks, taskId, &Task::getId);
+    if (task == tasks.end()) {
+        return std::unexpected(
+            AssignmentFailure{AssignmentError::TaskNotFound});
+    }
 
-            if (!employee->isAvailable(toAssign)) {
-                throw CompanyException(
-                    QString("Not enough available hours to assign %1 hours")
-                        .arg(toAssign));
-            }
+    auto needed = task->getEstimatedHours() - task->getAllocatedHours();
+    if (needed <= 0) {
+        return std::unexpected(
+            AssignmentFailure{AssignmentError::TaskFullyAllocated});
+    }
 
-            auto assignmentCost =
-                calculateEmployeeCost(employee->getSalary(), toAssign);
+    int toAssign = std::min(needed, hours);
+    if (!employee->isAvailable(toAssign)) {
+        return std::unexpected(
+            AssignmentFailure{AssignmentError::NotEnoughHours, toAssign});
+    }
 
-            if (assignmentCost >
-                projPtr->getBudget() - projPtr->getEmployeeCosts()) {
-                throw CompanyException(
-                    "Assignment would exceed project budget");
-            }
+    auto assignmentCost =
+        calculateEmployeeCost(employee->getSalary(), toAssign);
+    if (assignmentCost > projPtr->getBudget() - projPtr->getEmployeeCosts()) {
+        return std::unexpected(AssignmentFailure{AssignmentError::OverBudget});
+    }
 
-            employee->addWeeklyHours(toAssign);
-            employee->addAssignedProject(projectId);
-            task.addAllocatedHours(toAssign);
+    employee->addWeeklyHours(toAssign);
+    employee->addAssignedProject(projectId);
+    task->addAllocatedHours(toAssign);
 
-            taskAssignments[key] += toAssign;
-            projPtr->addEmployeeCost(assignmentCost);
-            projPtr->recomputeTotalsFromTasks();
-            found = true;
-            break;
-        }
-    }
-    if (!found) throw CompanyException("Task not found");
+    taskAssignments.add(employeeId, projectId, taskId, toAssign);
+    markAssignmentChanged(employeeId, projectId);
+    projPtr->addEmployeeCost(assignmentCost);
+    projPtr->recomputeTotalsFromTasks();
+    return toAssign;
 }
 
 void TaskAssignmentManager::restoreTaskAssignment(int employeeId, int projectId,
@@ -430,15 +644,12 @@ void TaskAssignmentManager::restoreTaskAssignment(int employeeId, int projectId,
     const std::vector<Task>& tasks = projPtr->getTasks();
     for (const auto& task : tasks) {
         if (task.getId() == taskId) {
-            auto key = std::make_tuple(employeeId, projectId, taskId);
-            int existingHours = 0;
-            if (auto it = taskAssignments.find(key);
-                it != taskAssignments.end()) {
-                existingHours = it->second;
-            }
+            int existingHours =
+                taskAssignments.get(employeeId, projectId, taskId);
 
             int newHours = hours - existingHours;
-            taskAssignments[key] = hours;
+            taskAssignments.set(employeeId, projectId, taskId, hours);
+            markAssignmentChanged(employeeId, projectId);
 
             employee->addToProjectHistory(projectId);
 
@@ -459,124 +670,177 @@ void TaskAssignmentManager::restoreTaskAssignment(int employeeId, int projectId,
     }
 }
 
+void TaskAssignmentManager::restoreTaskAssignments(
+    int projectId, int taskId, std::span<const std::pair<int, int>> saved) {
+    BulkLoad bulkLoad(*this);
+    for (const auto& [employeeId, hours] : saved) {
+        if (!TaskAssignmentStore::canPack(employeeId, projectId, taskId)) {
+            continue;
+        }
+        if (!tryAssignEmployeeToTask(employeeId, projectId, taskId, hours)) {
+            restoreTaskAssignment(employeeId, projectId, taskId, hours);
+        }
+    }
+}
+
 void TaskAssignmentManager::removeEmployeeTaskAssignments(int employeeId) {
-    std::erase_if(taskAssignments, [employeeId](const auto& pair) {
-        const auto& [key, hours] = pair;
-        const auto& [empId, projectId, taskId] = key;
-        return empId == employeeId;
-    });
+    markEmployeeChanged(employeeId);
+    taskAssignments.eraseEmployee(employeeId);
 }
 
 void TaskAssignmentManager::recalculateEmployeeHours() const {
-    resetEmployeeHours(employees);
-    applyTaskAssignmentsToEmployees(taskAssignments, employees);
+    for (const auto& employee : employees.view()) {
+        recalculateEmployeeWeeklyHours(*employee, taskAssignments);
+    }
 }
 
+// Walks each project's slice of the assignment index once, so the whole
+// pass costs O(projects + tasks + assignments) hash lookups instead of
+// O(projects * tasks * employees).
 void TaskAssignmentManager::recalculateTaskAllocatedHours() const {
-    clearProjectCosts(const_cast<ProjectContainer&>(projects));
-
-    auto allProjects = projects.getAll();
-    for (const auto& proj : allProjects) {
-        if (!proj) continue;
-        calculateTaskAllocatedHoursForProject(proj, employees, taskAssignments);
+    for (const auto& proj : projects.view()) {
+        calculateTaskAllocatedHoursForProject(*proj, employees,
+                                              taskAssignments);
     }
 }
 
-static void updateTaskAssignmentsFromStorage(
-    const std::map<int, std::vector<int>>& hoursStorage,
-    const std::vector<Assignment>& assignments, int employeeId,
-    std::map<std::tuple<int, int, int>, int>& taskAssignments) {
-    auto storageIt = hoursStorage.find(employeeId);
-    if (storageIt == hoursStorage.end()) {
-        return;
-    }
-    const auto& employeeStorage = storageIt->second;
-    for (const auto& assignment : assignments) {
-        auto key = std::make_tuple(employeeId, assignment.projectId,
-                                   assignment.taskId);
-        if (assignment.storageIndex < employeeStorage.size()) {
-            taskAssignments[key] = employeeStorage[assignment.storageIndex];
+void TaskAssignmentManager::fixTaskAssignmentsToCapacity() {
+    for (const auto& employee : employees.view()) {
+        if (taskAssignments.getEmployeeTotalHours(employee->getId()) >
+            employee->getWeeklyHoursCapacity()) {
+            markEmployeeChanged(employee->getId());
+            fitEmployeeAssignmentsToCapacity(*employee, taskAssignments);
         }
     }
 }
 
-void TaskAssignmentManager::fixTaskAssignmentsToCapacity() {
-    std::map<int, std::vector<int>> hoursStorage;
-    std::map<int, std::vector<Assignment>> employeeAssignments;
-    collectEmployeeAssignments(taskAssignments, hoursStorage,
-                               employeeAssignments);
+// Brings freshly loaded data into a consistent state in one walk over each
+// employee's assignments: hours over capacity are scaled down, weekly hours,
+// task allocations and project costs are rebuilt, inactive employees keep
+// their projects in history, and allocations no active employee backs are
+// cleared.
+LoadNormalization TaskAssignmentManager::normalizeLoadedData() {
+    std::unordered_map<int, ProjectTaskTotals> totalsByProject;
+    std::unordered_set<int> projectsWithActiveEmployees;
+    totalsByProject.reserve(projects.size());
+    for (const auto& project : projects.view()) {
+        totalsByProject.try_emplace(project->getId(), *project);
+    }
 
-    for (const auto& [employeeId, assignments] : employeeAssignments) {
-        std::shared_ptr<Employee> employee = employees.find(employeeId);
-        if (!employee) {
-            continue;
-        }
+    std::vector<std::tuple<int, int, int>> scaledAssignments;
+    for (const auto& employee : employees.view()) {
+        int employeeId = employee->getId();
         int capacity = employee->getWeeklyHoursCapacity();
-        scaleEmployeeAssignmentsToCapacity(hoursStorage, assignments,
-                                           employeeId, capacity);
-        updateTaskAssignmentsFromStorage(hoursStorage, assignments, employeeId,
-                                         taskAssignments);
+        int totalHours = taskAssignments.getEmployeeTotalHours(employeeId);
+        bool overCapacity = totalHours > capacity && totalHours > 0;
+        bool isActive = employee->getIsActive();
+
+        scaledAssignments.clear();
+        taskAssignments.forEachOfEmployee(
+            employeeId, [&](int projectId, int taskId, int hours) {
+                if (overCapacity) {
+                    hours = scaleHoursToCapacity(hours, totalHours, capacity);
+                    scaledAssignments.emplace_back(projectId, taskId, hours);
+                }
+
+                auto totalsIt = totalsByProject.find(projectId);
+                if (totalsIt == totalsByProject.end() || hours <= 0 ||
+                    !totalsIt->second.hasTask(taskId)) {
+                    return;
+                }
+                if (!isActive) {
+                    employee->addToProjectHistory(projectId);
+                }
+                if (employee->isAssignedToProject(projectId)) {
+                    totalsIt->second.add(taskId, *employee, hours);
+                }
+            });
+        for (const auto& [projectId, taskId, hours] : scaledAssignments) {
+            taskAssignments.set(employeeId, projectId, taskId, hours);
+        }
+
+        for (int projectId : employee->getAssignedProjects()) {
+            if (isActive) {
+                projectsWithActiveEmployees.insert(projectId);
+            } else {
+                employee->addToProjectHistory(projectId);
+            }
+        }
+        recalculateEmployeeWeeklyHours(*employee, taskAssignments);
     }
+
+    LoadNormalization normalization;
+    for (const auto& project : projects.view()) {
+        totalsByProject.at(project->getId()).applyTo(*project);
+        if (int allocatedHours = project->getAllocatedHours();
+            allocatedHours > 0 &&
+            !projectsWithActiveEmployees.contains(project->getId())) {
+            for (auto& task : project->getTasks()) {
+                task.setAllocatedHours(0);
+            }
+            project->recomputeTotalsFromTasks();
+            normalization.clearedProjectHours.emplace_back(project->getId(),
+                                                           allocatedHours);
+        }
+    }
+
+    clearChanges();
+    return normalization;
 }
 
-void TaskAssignmentManager::autoAssignEmployeesToProject(int projectId) {
+void TaskAssignmentManager::autoAssignEmployeesToProject(
+    int projectId, AutoAssignSolver solver) {
     std::shared_ptr<Project> projPtr = projects.find(projectId);
     if (!projPtr) throw CompanyException("Project not found");
+    if (projPtr->getTasks().empty()) return;
+
+    placeProjectAssignments(
+        *projPtr,
+        AssignmentCandidateIndex::rankByRate(
+            collectAssignmentCandidates(employees.view(), *projPtr)),
+        solver, taskAssignments);
+    markProjectChanged(projectId);
+}
 
-    auto& tasks = projPtr->getTasks();
-    if (tasks.empty()) return;
-
-    auto activeEmployees = getActiveEmployees(employees);
-    if (activeEmployees.empty()) return;
-
-    double projectBudget = projPtr->getBudget();
-    QString projectPhase = projPtr->getPhase();
-    int projectEstimatedHours = projPtr->getInitialEstimatedHours();
-    double maxAffordableHourlyRate = 0.0;
-    if (projectEstimatedHours > 0) {
-        maxAffordableHourlyRate =
-            projectBudget / static_cast<double>(projectEstimatedHours);
+AutoAssignSummary TaskAssignmentManager::autoAssignAllProjects(
+    AutoAssignOrder order, AutoAssignSolver solver) {
+    std::vector<Project*> queue;
+    for (const auto& project : projects.view()) {
+        if (project && project->getPhaseCode() != ProjectPhase::Completed &&
+            !project->getTasks().empty()) {
+            queue.push_back(project.get());
+        }
     }
+    sortProjectsForAutoAssign(queue, order);
+
+    auto employeeView = employees.view();
+    std::vector<std::vector<AssignmentCandidateIndex::Candidate>> ranked(
+        queue.size());
+    parallelFor(queue.size(), [&](size_t index) {
+        ranked[index] = AssignmentCandidateIndex::rankByRate(
+            collectAssignmentCandidates(employeeView, *queue[index]));
+    });
 
-    std::map<int, int> employeeUsage;
-    double currentEmployeeCosts = 0.0;
-    double remainingBudget = projectBudget - projPtr->getEmployeeCosts();
-
-    for (auto& task : tasks) {
-        ProcessTaskAssignmentParams params{task,
-                                           projectId,
-                                           projectBudget,
-                                           projectPhase,
-                                           projectEstimatedHours,
-                                           maxAffordableHourlyRate,
-                                           activeEmployees,
-                                           employeeUsage,
-                                           taskAssignments,
-                                           currentEmployeeCosts,
-                                           remainingBudget};
-        processTaskAssignment(params);
+    AutoAssignSummary summary;
+    for (size_t index = 0; index < queue.size(); ++index) {
+        Project& project = *queue[index];
+        int hoursPlaced = placeProjectAssignments(
+            project, std::move(ranked[index]), solver, taskAssignments);
+        summary.hoursByProject.emplace_back(project.getId(), hoursPlaced);
+        summary.totalHours += hoursPlaced;
+        markProjectChanged(project.getId());
     }
+    return summary;
 }
 
 int TaskAssignmentManager::getEmployeeProjectHours(int employeeId,
                                                    int projectId) const {
-    int total = 0;
-    for (const auto& [key, hours] : taskAssignments) {
-        const auto& [empId, projId, taskId] = key;
-        if (empId == employeeId && projId == projectId) {
-            total += hours;
-        }
-    }
-    return total;
+    return taskAssignments.getEmployeeProjectHours(employeeId, projectId);
 }
 
 int TaskAssignmentManager::getEmployeeTaskHours(int employeeId, int projectId,
                                                 int taskId) const {
-    auto key = std::make_tuple(employeeId, projectId, taskId);
-    if (auto it = taskAssignments.find(key); it != taskAssignments.end()) {
-        return it->second;
-    }
-    return 0;
+    return taskAssignments.get(employeeId, projectId, taskId);
 }
 
 void TaskAssignmentManager::scaleEmployeeTaskAssignments(int employeeId,
@@ -592,6 +856,7 @@ void TaskAssignmentManager::scaleEmployeeTaskAssignments(int employeeId,
 
     int capacity = employee->getWeeklyHoursCapacity();
     adjustAssignmentsToCapacity(assignmentsData, capacity, totalScaledHours);
+    markEmployeeChanged(employeeId);
     applyScaledAssignments(assignmentsData, employeeId, taskAssignments);
 }
 
@@ -602,31 +867,224 @@ int TaskAssignmentManager::getTaskAssignment(int employeeId, int projectId,
 
 void TaskAssignmentManager::setTaskAssignment(int employeeId, int projectId,
                                               int taskId, int hours) {
-    auto key = std::make_tuple(employeeId, projectId, taskId);
-    if (hours > 0) {
-        taskAssignments[key] = hours;
-    } else {
-        taskAssignments.erase(key);
-    }
+    taskAssignments.set(employeeId, projectId, taskId, hours);
+    markAssignmentChanged(employeeId, projectId);
 }
 
 void TaskAssignmentManager::addTaskAssignment(int employeeId, int projectId,
                                               int taskId, int hours) {
-    auto key = std::make_tuple(employeeId, projectId, taskId);
-    taskAssignments[key] += hours;
+    taskAssignments.add(employeeId, projectId, taskId, hours);
+    markAssignmentChanged(employeeId, projectId);
 }
 
 void TaskAssignmentManager::removeTaskAssignment(int employeeId, int projectId,
                                                  int taskId) {
-    auto key = std::make_tuple(employeeId, projectId, taskId);
-    taskAssignments.erase(key);
+    taskAssignments.erase(employeeId, projectId, taskId);
+    markAssignmentChanged(employeeId, projectId);
 }
 
 std::map<std::tuple<int, int, int>, int>
 TaskAssignmentManager::getAllTaskAssignments() const {
+    std::map<std::tuple<int, int, int>, int> result;
+    for (const auto& [key, hours] : taskAssignments.getOrderedEntries()) {
+        result.emplace_hint(result.end(), key, hours);
+    }
+    return result;
+}
+
+const TaskAssignmentStore& TaskAssignmentManager::getAssignmentStore() const {
     return taskAssignments;
 }
 
+void TaskAssignmentManager::notify(ModelChange::Kind kind, int employeeId,
+                                   int projectId) const {
+    if (changeObserver) {
+        changeObserver(ModelChange{kind, employeeId, projectId});
+    }
+}
+
+void TaskAssignmentManager::markAssignmentChanged(int employeeId,
+                                                  int projectId) {
+    if (bulkLoadDepth > 0) return;
+    markEmployeeChanged(employeeId);
+    changedProjects.insert(projectId);
+    notify(ModelChange::Kind::AssignmentsChanged, employeeId, projectId);
+}
+
+void TaskAssignmentManager::markEmployeeChanged(int employeeId) {
+    if (bulkLoadDepth > 0) return;
+    modelVersion = nextModelVersion();
+    changedEmployees.insert(employeeId);
+    unsavedChanges.employees.insert(employeeId);
+    notify(ModelChange::Kind::EmployeeChanged, employeeId, -1);
+    taskAssignments.forEachOfEmployee(
+        employeeId, [this, employeeId](int projectId, int, int) {
+            changedProjects.insert(projectId);
+            notify(ModelChange::Kind::AssignmentsChanged, employeeId,
+                   projectId);
+        });
+}
+
+void TaskAssignmentManager::markProjectChanged(int projectId) {
+    if (bulkLoadDepth > 0) return;
+    modelVersion = nextModelVersion();
+    changedProjects.insert(projectId);
+    unsavedChanges.projects.insert(projectId);
+    notify(ModelChange::Kind::ProjectChanged, -1, projectId);
+    taskAssignments.forEachOfProject(
+        projectId, [this, projectId](int employeeId, int, int) {
+            changedEmployees.insert(employeeId);
+            notify(ModelChange::Kind::AssignmentsChanged, employeeId,
+                   projectId);
+        });
+}
+
+void TaskAssignmentManager::markAllChanged() {
+    modelVersion = nextModelVersion();
+    fullRecalculationPending = true;
+    unsavedChanges.everything = true;
+}
+
+void TaskAssignmentManager::setChangeObserver(ModelChangeObserver observer) {
+    changeObserver = std::move(observer);
+}
+
+void TaskAssignmentManager::takeChangesFrom(TaskAssignmentManager& other) {
+    changedEmployees = std::move(other.changedEmployees);
+    changedProjects = std::move(other.changedProjects);
+    fullRecalculationPending = other.fullRecalculationPending;
+    unsavedChanges = std::move(other.unsavedChanges);
+    modelVersion = nextModelVersion();
+}
+
+bool TaskAssignmentManager::hasPendingChanges() const {
+    return fullRecalculationPending || !changedEmployees.empty() ||
+           !changedProjects.empty();
+}
+
+void TaskAssignmentManager::clearChanges() {
+    changedEmployees.clear();
+    changedProjects.clear();
+    fullRecalculationPending = false;
+}
+
+void TaskAssignmentManager::recalculateChangedOnly() {
+    std::vector<std::shared_ptr<Employee>> touchedEmployees;
+    touchedEmployees.reserve(changedEmployees.size());
+    for (int employeeId : changedEmployees) {
+        std::shared_ptr<Employee> employee = employees.find(employeeId);
+        if (!employee) continue;
+        if (taskAssignments.getEmployeeTotalHours(employeeId) >
+            employee->getWeeklyHoursCapacity()) {
+            taskAssignments.forEachOfEmployee(
+                employeeId, [this](int projectId, int, int) {
+                    changedProjects.insert(projectId);
+                });
+            fitEmployeeAssignmentsToCapacity(*employee, taskAssignments);
+        }
+        touchedEmployees.emplace_back(std::move(employee));
+    }
+
+    for (const auto& employee : touchedEmployees) {
+        recalculateEmployeeWeeklyHours(*employee, taskAssignments);
+    }
+    for (int projectId : changedProjects) {
+        if (std::shared_ptr<Project> project = projects.find(projectId);
+            project) {
+            calculateTaskAllocatedHoursForProject(*project, employees,
+                                                  taskAssignments);
+        }
+    }
+}
+
+void TaskAssignmentManager::recalculateEverything() {
+    fixTaskAssignmentsToCapacity();
+    recalculateEmployeeHours();
+    recalculateTaskAllocatedHours();
+}
+
+struct DerivedTotals {
+    std::map<int, int> weeklyHours;
+    std::map<int, double> employeeCosts;
+    std::map<std::pair<int, int>, int> allocatedHours;
+};
+
+static DerivedTotals captureDerivedTotals(const EmployeeContainer& employees,
+                                          const ProjectContainer& projects) {
+    DerivedTotals totals;
+    for (const auto& employee : employees.view()) {
+        totals.weeklyHours.emplace(employee->getId(),
+                                   employee->getCurrentWeeklyHours());
+    }
+    for (const auto& project : projects.view()) {
+        totals.employeeCosts.emplace(project->getId(),
+                                     project->getEmployeeCosts());
+        for (const auto& task : std::as_const(*project).getTasks()) {
+            totals.allocatedHours.emplace(
+                std::make_pair(project->getId(), task.getId()),
+                task.getAllocatedHours());
+        }
+    }
+    return totals;
+}
+
+static void reportDerivedTotalsMismatch(const DerivedTotals& incremental,
+                                        const DerivedTotals& full) {
+    for (const auto& [employeeId, hours] : full.weeklyHours) {
+        if (auto it = incremental.weeklyHours.find(employeeId);
+            it == incremental.weeklyHours.end() || it->second != hours) {
+            qCWarning(companyManagers)
+                << "Incremental recalculation missed weekly hours of employee"
+                << employeeId;
+        }
+    }
+    for (const auto& [projectId, costs] : full.employeeCosts) {
+        if (auto it = incremental.employeeCosts.find(projectId);
+            it == incremental.employeeCosts.end() ||
+            std::abs(it->second - costs) > kCostTolerance) {
+            qCWarning(companyManagers)
+                << "Incremental recalculation missed costs of project"
+                << projectId;
+        }
+    }
+    for (const auto& [key, hours] : full.allocatedHours) {
+        if (auto it = incremental.allocatedHours.find(key);
+            it == incremental.allocatedHours.end() || it->second != hours) {
+            qCWarning(companyManagers)
+                << "Incremental recalculation missed allocated hours of task"
+                << key.second << "in project" << key.first;
+        }
+    }
+}
+
+const UnsavedChanges& TaskAssignmentManager::getUnsavedChanges() const {
+    return unsavedChanges;
+}
+
+void TaskAssignmentManager::clearUnsavedChanges() {
+    unsavedChanges.employees.clear();
+    unsavedChanges.projects.clear();
+    unsavedChanges.everything = false;
+}
+
+void TaskAssignmentManager::recalculateChanged(RecalculationMode mode) {
+    if (hasPendingChanges() || mode != RecalculationMode::Incremental) {
+        modelVersion = nextModelVersion();
+    }
+    if (fullRecalculationPending || mode == RecalculationMode::Full) {
+        recalculateEverything();
+    } else if (mode == RecalculationMode::Verify) {
+        recalculateChangedOnly();
+        DerivedTotals incremental = captureDerivedTotals(employees, projects);
+        recalculateEverything();
+        reportDerivedTotalsMismatch(incremental,
+                                    captureDerivedTotals(employees, projects));
+    } else {
+        recalculateChangedOnly();
+    }
+    clearChanges();
+}
+
 int CompanyStatistics::getEmployeeCount() const {
     return static_cast<int>(employees.size());
 }
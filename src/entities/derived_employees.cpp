@@ -11,6 +11,8 @@ Manager::Manager(int employeeId, QString employeeName, double employeeSalary,
 
 QString Manager::getEmployeeType() const { return "Manager"; }
 
+EmployeeType Manager::getTypeCode() const { return EmployeeType::Manager; }
+
 QString Manager::getDetails() const {
     return Employee::getDetails() +
            QString(", Managed Project ID: %1").arg(managedProjectId);
@@ -42,6 +44,8 @@ Developer::Developer(int employeeId, QString employeeName,
 
 QString Developer::getEmployeeType() const { return "Developer"; }
 
+EmployeeType Developer::getTypeCode() const { return EmployeeType::Developer; }
+
 QString Developer::getDetails() const {
     return Employee::getDetails() +
            QString(", Language: %1, Experience: %2 years")
@@ -68,6 +72,8 @@ Designer::Designer(int employeeId, QString employeeName, double employeeSalary,
 
 QString Designer::getEmployeeType() const { return "Designer"; }
 
+EmployeeType Designer::getTypeCode() const { return EmployeeType::Designer; }
+
 QString Designer::getDetails() const {
     return Employee::getDetails() + QString(", Tool: %1, Projects: %2")
                                         .arg(designTool)
@@ -93,6 +99,8 @@ QA::QA(int employeeId, QString employeeName, double employeeSalary,
 
 QString QA::getEmployeeType() const { return "QA"; }
 
+EmployeeType QA::getTypeCode() const { return EmployeeType::QA; }
+
 QString QA::getDetails() const {
     return Employee::getDetails() +
            QString(", Testing Type: %1, Bugs Found: %2")
@@ -0,0 +1,131 @@
+#include "entities/employee_search_index.h"
+
+#include <algorithm>
+#include <mutex>
+
+static constexpr char16_t kFieldSeparator = u'\n';
+
+static QString searchTextOf(const Employee& employee) {
+    return employee.getName().toLower() + QChar(kFieldSeparator) +
+           employee.getDepartment().toLower() + QChar(kFieldSeparator) +
+           employee.getPosition().toLower();
+}
+
+EmployeeSearchIndex::EmployeeSearchIndex(
+    std::span<const std::shared_ptr<Employee>> employees) {
+    entries.reserve(employees.size());
+    for (const auto& employee : employees) {
+        if (employee) addLocked(*employee);
+    }
+}
+
+std::vector<EmployeeSearchIndex::Trigram> EmployeeSearchIndex::trigramsOf(
+    const QString& text) {
+    std::vector<Trigram> trigrams;
+    for (int start = 0; start + 3 <= text.size(); ++start) {
+        Trigram key = 0;
+        bool crossesField = false;
+        for (int offset = 0; offset < 3; ++offset) {
+            char16_t unit = text.at(start + offset).unicode();
+            crossesField = crossesField || unit == kFieldSeparator;
+            key = (key << 16) | unit;
+        }
+        if (!crossesField) trigrams.push_back(key);
+    }
+    std::ranges::sort(trigrams);
+    auto duplicates = std::ranges::unique(trigrams);
+    trigrams.erase(duplicates.begin(), duplicates.end());
+    return trigrams;
+}
+
+void EmployeeSearchIndex::add(const Employee& employee) {
+    std::unique_lock lock(mutex);
+    removeLocked(employee.getId());
+    addLocked(employee);
+}
+
+void EmployeeSearchIndex::remove(int employeeId) {
+    std::unique_lock lock(mutex);
+    removeLocked(employeeId);
+}
+
+void EmployeeSearchIndex::update(const Employee& employee) { add(employee); }
+
+void EmployeeSearchIndex::addLocked(const Employee& employee) {
+    Entry entry{searchTextOf(employee), {}};
+    if (postingsBuilt) {
+        entry.trigrams = trigramsOf(entry.text);
+        for (Trigram trigram : entry.trigrams) {
+            postings[trigram].push_back(employee.getId());
+        }
+    }
+    entries.insert_or_assign(employee.getId(), std::move(entry));
+}
+
+void EmployeeSearchIndex::buildPostingsLocked() {
+    if (postingsBuilt) return;
+    for (auto& [employeeId, entry] : entries) {
+        entry.trigrams = trigramsOf(entry.text);
+        for (Trigram trigram : entry.trigrams) {
+            postings[trigram].push_back(employeeId);
+        }
+    }
+    postingsBuilt = true;
+}
+
+void EmployeeSearchIndex::removeLocked(int employeeId) {
+    auto found = entries.find(employeeId);
+    if (found == entries.end()) return;
+
+    for (Trigram trigram : found->second.trigrams) {
+        auto posting = postings.find(trigram);
+        if (posting == postings.end()) continue;
+        std::erase(posting->second, employeeId);
+        if (posting->second.empty()) postings.erase(posting);
+    }
+    entries.erase(found);
+}
+
+std::vector<int> EmployeeSearchIndex::search(const QString& term) {
+    QString lowercaseTerm = term.toLower();
+    {
+        std::shared_lock lock(mutex);
+        if (postingsBuilt || lowercaseTerm.size() < 3) {
+            return searchLocked(lowercaseTerm);
+        }
+    }
+    std::unique_lock lock(mutex);
+    buildPostingsLocked();
+    return searchLocked(lowercaseTerm);
+}
+
+std::vector<int> EmployeeSearchIndex::searchLocked(
+    const QString& lowercaseTerm) const {
+    std::vector<int> matches;
+
+    if (lowercaseTerm.size() < 3) {
+        for (const auto& [employeeId, entry] : entries) {
+            if (entry.text.contains(lowercaseTerm)) {
+                matches.push_back(employeeId);
+            }
+        }
+        return matches;
+    }
+
+    const std::vector<int>* rarest = nullptr;
+    for (Trigram trigram : trigramsOf(lowercaseTerm)) {
+        auto posting = postings.find(trigram);
+        if (posting == postings.end()) return matches;
+        if (!rarest || posting->second.size() < rarest->size()) {
+            rarest = &posting->second;
+        }
+    }
+    if (!rarest) return matches;
+
+    for (int employeeId : *rarest) {
+        if (entries.at(employeeId).text.contains(lowercaseTerm)) {
+            matches.push_back(employeeId);
+        }
+    }
+    return matches;
+}
@@ -14,6 +14,8 @@ QString Project::getDescription() const { return description; }
 
 QString Project::getPhase() const { return phase; }
 
+ProjectPhase Project::getPhaseCode() const { return phaseCode; }
+
 QDate Project::getStartDate() const { return startDate; }
 
 QDate Project::getEndDate() const { return endDate; }
@@ -27,6 +29,7 @@ Project::Project(const ProjectParams& params)
       name(params.name),
       description(params.description),
       phase(params.phase),
+      phaseCode(projectPhaseFromString(params.phase)),
       startDate(params.startDate),
       endDate(params.endDate),
       budget(params.budget),
@@ -60,24 +63,17 @@ Project::Project(const ProjectParams& params)
 }
 
 int Project::getPhaseOrder(const QString& phaseName) {
-    if (phaseName == "Analysis") return 0;
-    if (phaseName == "Planning") return 1;
-    if (phaseName == "Design") return 2;
-    if (phaseName == "Development") return 3;
-    if (phaseName == "Testing") return 4;
-    if (phaseName == "Deployment") return 5;
-    if (phaseName == "Maintenance") return 6;
-    if (phaseName == "Completed") return 7;
-    return -1;
+    return ::getPhaseOrder(projectPhaseFromString(phaseName));
 }
 
 void Project::setPhase(const QString& newPhase) {
     if (newPhase.isEmpty()) {
         throw ProjectException("phase cannot be empty");
     }
-    int currentPhaseOrder = getPhaseOrder(phase);
+    ProjectPhase newPhaseCode = projectPhaseFromString(newPhase);
+    int currentPhaseOrder = ::getPhaseOrder(phaseCode);
 
-    if (int newPhaseOrder = getPhaseOrder(newPhase);
+    if (int newPhaseOrder = ::getPhaseOrder(newPhaseCode);
         currentPhaseOrder >= 0 && newPhaseOrder >= 0 &&
         newPhaseOrder < currentPhaseOrder) {
         throw ProjectException(
@@ -88,6 +84,7 @@ void Project::setPhase(const QString& newPhase) {
                 .arg(newPhase, phase));
     }
     phase = newPhase;
+    phaseCode = newPhaseCode;
 }
 
 void Project::setBudget(double newBudget) {
@@ -100,12 +97,9 @@ void Project::setBudget(double newBudget) {
 bool Project::isActive() const {
     QDate currentDate = QDate::currentDate();
 
-    bool isActivePhase =
-        (phase == "Analysis" || phase == "Planning" || phase == "Design" ||
-         phase == "Development" || phase == "Testing" ||
-         phase == "Deployment" || phase == "Maintenance");
-    return isActivePhase && (currentDate >= startDate &&
-                             (endDate.isNull() || currentDate <= endDate));
+    return isActivePhase(phaseCode) &&
+           (currentDate >= startDate &&
+            (endDate.isNull() || currentDate <= endDate));
 }
 
 int Project::getEstimatedHours() const {
@@ -7,6 +7,7 @@ Task::Task(int taskId, const QString& name, const QString& type,
     : id(taskId),
       name(name),
       type(type),
+      typeCode(taskTypeFromString(type)),
       estimatedHours(estimatedHours),
       priority(priority) {
     if (name.isEmpty()) throw TaskException("Task name cannot be empty");
@@ -20,6 +21,8 @@ QString Task::getName() const { return name; }
 
 QString Task::getType() const { return type; }
 
+TaskType Task::getTypeCode() const { return typeCode; }
+
 int Task::getEstimatedHours() const { return estimatedHours; }
 
 int Task::getAllocatedHours() const { return allocatedHours; }
@@ -0,0 +1,263 @@
+#include "entities/task_assignment_store.h"
+
+#include <QString>
+#include <algorithm>
+#include <bit>
+
+#include "exceptions/exceptions.h"
+
+static constexpr size_t kMinSlotCount = 16;
+
+static size_t hashPackedKey(TaskAssignmentStore::PackedKey key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return static_cast<size_t>(key);
+}
+
+bool TaskAssignmentStore::canPack(int employeeId, int projectId, int taskId) {
+    auto inRange = [](int id) { return id >= 0 && id <= kMaxPackableId; };
+    return inRange(employeeId) && inRange(projectId) && inRange(taskId);
+}
+
+TaskAssignmentStore::PackedKey TaskAssignmentStore::pack(int employeeId,
+                                                         int projectId,
+                                                         int taskId) {
+    if (!canPack(employeeId, projectId, taskId)) {
+        throw CompanyException(
+            QString("Assignment ids out of range (max %1): %2/%3/%4")
+                .arg(kMaxPackableId)
+                .arg(employeeId)
+                .arg(projectId)
+                .arg(taskId));
+    }
+    return (static_cast<PackedKey>(employeeId) << (2 * kIdBits)) |
+           (static_cast<PackedKey>(projectId) << kIdBits) |
+           static_cast<PackedKey>(taskId);
+}
+
+TaskAssignmentStore::Key TaskAssignmentStore::unpack(PackedKey key) {
+    constexpr PackedKey mask = (PackedKey{1} << kIdBits) - 1;
+    return {static_cast<int>(key >> (2 * kIdBits)),
+            static_cast<int>((key >> kIdBits) & mask),
+            static_cast<int>(key & mask)};
+}
+
+size_t TaskAssignmentStore::findSlot(PackedKey key) const {
+    if (slotKeys.empty()) return slotKeys.size();
+
+    size_t mask = slotKeys.size() - 1;
+    for (size_t slot = hashPackedKey(key) & mask;;
+         slot = (slot + 1) & mask) {
+        if (slotKeys[slot] == key) return slot;
+        if (slotKeys[slot] == kEmptySlot) return slotKeys.size();
+    }
+}
+
+void TaskAssignmentStore::insertNew(PackedKey key, int hours) {
+    if ((count + 1) * 2 > slotKeys.size()) {
+        rehash(std::max(kMinSlotCount, slotKeys.size() * 2));
+    }
+
+    size_t mask = slotKeys.size() - 1;
+    size_t slot = hashPackedKey(key) & mask;
+    while (slotKeys[slot] != kEmptySlot) {
+        slot = (slot + 1) & mask;
+    }
+    slotKeys[slot] = key;
+    slotHours[slot] = hours;
+    ++count;
+}
+
+void TaskAssignmentStore::eraseSlot(size_t slot) {
+    size_t mask = slotKeys.size() - 1;
+    size_t hole = slot;
+    for (size_t next = (hole + 1) & mask; slotKeys[next] != kEmptySlot;
+         next = (next + 1) & mask) {
+        size_t home = hashPackedKey(slotKeys[next]) & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            slotKeys[hole] = slotKeys[next];
+            slotHours[hole] = slotHours[next];
+            hole = next;
+        }
+    }
+    slotKeys[hole] = kEmptySlot;
+    slotHours[hole] = 0;
+    --count;
+}
+
+void TaskAssignmentStore::rehash(size_t newCapacity) {
+    std::vector<PackedKey> oldKeys(newCapacity, kEmptySlot);
+    std::vector<int> oldHours(newCapacity, 0);
+    oldKeys.swap(slotKeys);
+    oldHours.swap(slotHours);
+    count = 0;
+
+    for (size_t slot = 0; slot < oldKeys.size(); ++slot) {
+        if (oldKeys[slot] != kEmptySlot) {
+            insertNew(oldKeys[slot], oldHours[slot]);
+        }
+    }
+}
+
+// Loads and saves walk keys in ascending order, so the common insert is an
+// append.
+static void insertSorted(std::vector<TaskAssignmentStore::PackedKey>& keys,
+                         TaskAssignmentStore::PackedKey key) {
+    if (keys.empty() || keys.back() < key) {
+        keys.push_back(key);
+        return;
+    }
+    keys.insert(std::ranges::lower_bound(keys, key), key);
+}
+
+static void eraseSorted(std::vector<TaskAssignmentStore::PackedKey>& keys,
+                        TaskAssignmentStore::PackedKey key) {
+    if (auto it = std::ranges::lower_bound(keys, key);
+        it != keys.end() && *it == key) {
+        keys.erase(it);
+    }
+}
+
+void TaskAssignmentStore::link(PackedKey key) {
+    const auto& [employeeId, projectId, taskId] = unpack(key);
+    insertSorted(byEmployee[employeeId], key);
+    insertSorted(byProject[projectId], key);
+}
+
+void TaskAssignmentStore::unlink(PackedKey key) {
+    const auto& [employeeId, projectId, taskId] = unpack(key);
+    if (auto it = byEmployee.find(employeeId); it != byEmployee.end()) {
+        eraseSorted(it->second, key);
+        if (it->second.empty()) byEmployee.erase(it);
+    }
+    if (auto it = byProject.find(projectId); it != byProject.end()) {
+        eraseSorted(it->second, key);
+        if (it->second.empty()) byProject.erase(it);
+    }
+}
+
+int TaskAssignmentStore::get(int employeeId, int projectId, int taskId) const {
+    if (!canPack(employeeId, projectId, taskId)) return 0;
+    if (size_t slot = findSlot(pack(employeeId, projectId, taskId));
+        slot < slotKeys.size()) {
+        return slotHours[slot];
+    }
+    return 0;
+}
+
+void TaskAssignmentStore::set(int employeeId, int projectId, int taskId,
+                              int hours) {
+    if (hours <= 0) {
+        erase(employeeId, projectId, taskId);
+        return;
+    }
+    PackedKey key = pack(employeeId, projectId, taskId);
+    if (size_t slot = findSlot(key); slot < slotKeys.size()) {
+        slotHours[slot] = hours;
+        return;
+    }
+    insertNew(key, hours);
+    link(key);
+}
+
+void TaskAssignmentStore::add(int employeeId, int projectId, int taskId,
+                              int hours) {
+    set(employeeId, projectId, taskId,
+        get(employeeId, projectId, taskId) + hours);
+}
+
+void TaskAssignmentStore::erase(int employeeId, int projectId, int taskId) {
+    if (!canPack(employeeId, projectId, taskId)) return;
+    PackedKey key = pack(employeeId, projectId, taskId);
+    if (size_t slot = findSlot(key); slot < slotKeys.size()) {
+        eraseSlot(slot);
+        unlink(key);
+    }
+}
+
+void TaskAssignmentStore::eraseEmployee(int employeeId) {
+    auto it = byEmployee.find(employeeId);
+    if (it == byEmployee.end()) return;
+
+    std::vector<PackedKey> keys = it->second;
+    for (PackedKey key : keys) {
+        const auto& [empId, projectId, taskId] = unpack(key);
+        erase(empId, projectId, taskId);
+    }
+}
+
+void TaskAssignmentStore::eraseProject(int projectId) {
+    auto it = byProject.find(projectId);
+    if (it == byProject.end()) return;
+
+    std::vector<PackedKey> keys = it->second;
+    for (PackedKey key : keys) {
+        const auto& [employeeId, projId, taskId] = unpack(key);
+        erase(employeeId, projId, taskId);
+    }
+}
+
+void TaskAssignmentStore::clear() {
+    slotKeys.clear();
+    slotHours.clear();
+    count = 0;
+    byEmployee.clear();
+    byProject.clear();
+}
+
+void TaskAssignmentStore::reserve(size_t expected) {
+    size_t needed = std::bit_ceil(std::max(kMinSlotCount, expected * 2));
+    if (needed > slotKeys.size()) {
+        rehash(needed);
+    }
+}
+
+size_t TaskAssignmentStore::size() const { return count; }
+
+bool TaskAssignmentStore::empty() const { return count == 0; }
+
+int TaskAssignmentStore::getEmployeeTotalHours(int employeeId) const {
+    int total = 0;
+    forEachOfEmployee(employeeId,
+                      [&total](int, int, int hours) { total += hours; });
+    return total;
+}
+
+int TaskAssignmentStore::getEmployeeProjectHours(int employeeId,
+                                                 int projectId) const {
+    if (!canPack(employeeId, projectId, 0)) return 0;
+    auto it = byEmployee.find(employeeId);
+    if (it == byEmployee.end()) return 0;
+
+    int total = 0;
+    const auto& keys = it->second;
+    for (auto keyIt = std::ranges::lower_bound(keys,
+                                               pack(employeeId, projectId, 0));
+         keyIt != keys.end() && std::get<1>(unpack(*keyIt)) == projectId;
+         ++keyIt) {
+        total += slotHours[findSlot(*keyIt)];
+    }
+    return total;
+}
+
+std::vector<std::pair<TaskAssignmentStore::Key, int>>
+TaskAssignmentStore::getOrderedEntries() const {
+    std::vector<std::pair<PackedKey, int>> packed;
+    packed.reserve(count);
+    for (size_t slot = 0; slot < slotKeys.size(); ++slot) {
+        if (slotKeys[slot] != kEmptySlot) {
+            packed.emplace_back(slotKeys[slot], slotHours[slot]);
+        }
+    }
+    std::ranges::sort(packed, {}, &std::pair<PackedKey, int>::first);
+
+    std::vector<std::pair<Key, int>> entries;
+    entries.reserve(packed.size());
+    for (const auto& [key, hours] : packed) {
+        entries.emplace_back(unpack(key), hours);
+    }
+    return entries;
+}
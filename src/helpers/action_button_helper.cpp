@@ -1,137 +1,70 @@
 #include "helpers/action_button_helper.h"
 
 #include <QAction>
-#include <QEvent>
-#include <QHBoxLayout>
 #include <QMenu>
-#include <QPushButton>
-#include <QTableWidget>
-#include <QTimer>
-#include <QWidget>
+#include <QTableView>
 #include <functional>
 
+#include "ui/action_button_delegate.h"
 #include "ui/main_window.h"
 #include "ui/main_window_operations.h"
 
-QWidget* createActionContainer(QTableWidget* table) {
-    auto* actionContainer = new QWidget(table);
-    auto* actionLayout = new QHBoxLayout(actionContainer);
-    actionLayout->setContentsMargins(0, 0, 0, 0);
-    actionLayout->setAlignment(Qt::AlignCenter);
-    return actionContainer;
+static void addAction(QMenu* menu, const QString& text, MainWindow* mainWindow,
+                      const std::function<void(MainWindow*)>& operation) {
+    const auto* action = menu->addAction(text);
+    QObject::connect(action, &QAction::triggered, menu,
+                     [mainWindow, operation]() { operation(mainWindow); });
 }
 
-QPushButton* createActionButton(QWidget* parent) {
-    auto* actionButton = new QPushButton("Actions", parent);
-    actionButton->setFixedHeight(38);
-    actionButton->setMinimumWidth(150);
-    return actionButton;
+static void installActionDelegate(QTableView* table,
+                                  ActionButtonDelegate::MenuBuilder builder) {
+    if (!table || !table->model()) return;
+    int actionColumn = table->model()->columnCount() - 1;
+    table->setItemDelegateForColumn(
+        actionColumn, new ActionButtonDelegate(table, std::move(builder)));
 }
 
-void connectAction(const QAction* action, QTableWidget* table,
-                   const MainWindow* mainWindow, int rowIndex,
-                   const std::function<void()>& operation) {
-    QObject::connect(action, &QAction::triggered, table,
-                     [table, mainWindow, row = rowIndex, operation]() {
-                         table->setCurrentCell(row, 0);
-                         if (mainWindow) {
-                             operation();
-                         }
-                     });
-}
-
-QWidget* ActionButtonHelper::createEmployeeActionButtons(
-    QTableWidget* table, int rowIndex, MainWindow* mainWindow) {
-    if (!table || !mainWindow) return nullptr;
-
-    auto* actionContainer = createActionContainer(table);
-    auto* actionButton = createActionButton(actionContainer);
-    auto* actionMenu = new QMenu(actionButton);
-
-    const auto* editAction = actionMenu->addAction("🖉 Edit");
-    const auto* fireAction = actionMenu->addAction("❌ Fire");
-    const auto* deleteAction = actionMenu->addAction("🗑️ Delete");
-    const auto* historyAction = actionMenu->addAction("📋 History");
-
-    actionButton->setMenu(actionMenu);
-    qobject_cast<QHBoxLayout*>(actionContainer->layout())
-        ->addWidget(actionButton);
-
-    connectAction(editAction, table, mainWindow, rowIndex, [mainWindow]() {
-        EmployeeOperations::editEmployee(mainWindow);
-    });
-    connectAction(fireAction, table, mainWindow, rowIndex, [mainWindow]() {
-        EmployeeOperations::fireEmployee(mainWindow);
-    });
-    connectAction(deleteAction, table, mainWindow, rowIndex, [mainWindow]() {
-        EmployeeOperations::deleteEmployee(mainWindow);
-    });
-    connectAction(historyAction, table, mainWindow, rowIndex, [mainWindow]() {
-        ProjectOperations::viewEmployeeHistory(mainWindow);
-    });
+void ActionButtonHelper::populateEmployeeActions(QMenu* menu,
+                                                 MainWindow* mainWindow) {
+    if (!menu || !mainWindow) return;
 
-    return actionContainer;
+    addAction(menu, "🖉 Edit", mainWindow, EmployeeOperations::editEmployee);
+    addAction(menu, "❌ Fire", mainWindow, EmployeeOperations::fireEmployee);
+    addAction(menu, "🗑️ Delete", mainWindow,
+              EmployeeOperations::deleteEmployee);
+    addAction(menu, "📋 History", mainWindow,
+              ProjectOperations::viewEmployeeHistory);
 }
 
-QWidget* ActionButtonHelper::createProjectActionButtons(QTableWidget* table,
-                                                        int rowIndex,
-                                                        MainWindow* mainWindow,
-                                                        bool includeAddTask) {
-    if (!table || !mainWindow) return nullptr;
+void ActionButtonHelper::populateProjectActions(QMenu* menu,
+                                                MainWindow* mainWindow,
+                                                bool includeAddTask) {
+    if (!menu || !mainWindow) return;
 
-    auto* actionContainer = createActionContainer(table);
-    auto* actionButton = createActionButton(actionContainer);
-    auto* actionMenu = new QMenu(actionButton);
-
-    const auto* editAction = actionMenu->addAction("🖉 Edit");
-    const auto* deleteAction = actionMenu->addAction("🗑️ Delete");
+    addAction(menu, "🖉 Edit", mainWindow, ProjectOperations::editProject);
+    addAction(menu, "🗑️ Delete", mainWindow, ProjectOperations::deleteProject);
 
     if (includeAddTask) {
-        actionMenu->addSeparator();
-        const auto* addTaskAction = actionMenu->addAction("➕ Add Task");
-        connectAction(
-            addTaskAction, table, mainWindow, rowIndex,
-            [mainWindow]() { ProjectOperations::addProjectTask(mainWindow); });
+        menu->addSeparator();
+        addAction(menu, "➕ Add Task", mainWindow,
+                  ProjectOperations::addProjectTask);
     }
 
-    actionMenu->addSeparator();
-    const auto* moreAction = actionMenu->addAction("📋 More");
-
-    QObject::connect(
-        actionMenu, &QMenu::aboutToShow, actionMenu,
-        [actionButton, actionMenu]() {
-            const int buttonWidth = actionButton->width();
-            actionMenu->setMinimumWidth(buttonWidth);
-            const QPoint pos =
-                actionButton->mapToGlobal(QPoint(0, actionButton->height()));
-            QTimer::singleShot(0, actionMenu,
-                               [actionMenu, pos]() { actionMenu->move(pos); });
-            QTimer::singleShot(10, actionMenu, [actionMenu, pos]() {
-                if (actionMenu->isVisible()) {
-                    actionMenu->move(pos);
-                }
-            });
-            QTimer::singleShot(30, actionMenu, [actionMenu, pos]() {
-                if (actionMenu->isVisible()) {
-                    actionMenu->move(pos);
-                }
-            });
-        });
-
-    actionButton->setMenu(actionMenu);
-
-    qobject_cast<QHBoxLayout*>(actionContainer->layout())
-        ->addWidget(actionButton);
+    menu->addSeparator();
+    addAction(menu, "📋 More", mainWindow,
+              ProjectOperations::openProjectDetails);
+}
 
-    connectAction(editAction, table, mainWindow, rowIndex, [mainWindow]() {
-        ProjectOperations::editProject(mainWindow);
-    });
-    connectAction(deleteAction, table, mainWindow, rowIndex, [mainWindow]() {
-        ProjectOperations::deleteProject(mainWindow);
-    });
-    connectAction(moreAction, table, mainWindow, rowIndex, [mainWindow]() {
-        ProjectOperations::openProjectDetails(mainWindow);
+void ActionButtonHelper::installEmployeeActions(QTableView* table,
+                                                MainWindow* mainWindow) {
+    installActionDelegate(table, [mainWindow](QMenu* menu) {
+        populateEmployeeActions(menu, mainWindow);
     });
+}
 
-    return actionContainer;
+void ActionButtonHelper::installProjectActions(QTableView* table,
+                                               MainWindow* mainWindow) {
+    installActionDelegate(table, [mainWindow](QMenu* menu) {
+        populateProjectActions(menu, mainWindow);
+    });
 }
@@ -1,19 +1,14 @@
 #include "helpers/display_helper.h"
 
-#include <QHBoxLayout>
-#include <QMenu>
 #include <QMetaObject>
 #include <QObject>
-#include <QPushButton>
 #include <QStringList>
-#include <QTableWidgetItem>
 #include <QWidget>
 #include <algorithm>
 #include <map>
 #include <ranges>
 
 #include "entities/derived_employees.h"
-#include "helpers/action_button_helper.h"
 #include "ui/main_window.h"
 
 QString DisplayHelper::formatProjectInfo(
@@ -72,7 +67,7 @@ static void collectTaskNamesFromProject(int projectId,
         return;
     }
 
-    auto tasks = currentCompany->getProjectTasks(projectId);
+    auto tasks = currentCompany->getProjectTasksView(projectId);
     for (const auto& task : tasks) {
         if (task.getAllocatedHours() > 0) {
             QString taskName = task.getName();
@@ -98,95 +93,6 @@ QString DisplayHelper::formatTaskInfo(
     return taskInfoList.isEmpty() ? "-" : taskInfoList.join(", ");
 }
 
-static void populateEmployeeRow(QTableWidget* employeeTable, size_t index,
-                                const std::shared_ptr<Employee>& employee,
-                                const Company* currentCompany,
-                                MainWindow* mainWindow) {
-    employeeTable->setItem(
-        index, 0, new QTableWidgetItem(QString::number(employee->getId())));
-    employeeTable->setItem(index, 1, new QTableWidgetItem(employee->getName()));
-    employeeTable->setItem(index, 2,
-                           new QTableWidgetItem(employee->getDepartment()));
-    employeeTable->setItem(
-        index, 3,
-        new QTableWidgetItem(QString::number(employee->getSalary(), 'f', 2)));
-    employeeTable->setItem(index, 4,
-                           new QTableWidgetItem(employee->getEmployeeType()));
-
-    QString projectInfo =
-        DisplayHelper::formatProjectInfo(employee, currentCompany);
-    employeeTable->setItem(index, 5, new QTableWidgetItem(projectInfo));
-
-    if (QWidget* actionWidget = ActionButtonHelper::createEmployeeActionButtons(
-            employeeTable, static_cast<int>(index), mainWindow)) {
-        employeeTable->setCellWidget(index, 6, actionWidget);
-    }
-}
-
-static void setInactiveEmployeeStyle(const QTableWidget* employeeTable,
-                                     size_t index) {
-    for (int col = 0; col < employeeTable->columnCount(); ++col) {
-        if (QTableWidgetItem* item = employeeTable->item(index, col); item) {
-            item->setForeground(QBrush(QColor("#666666")));
-        }
-    }
-}
-
-void DisplayHelper::displayEmployees(QTableWidget* employeeTable,
-                                     const Company* currentCompany,
-                                     MainWindow* mainWindow) {
-    if (currentCompany == nullptr || employeeTable == nullptr) return;
-
-    auto employees = currentCompany->getAllEmployees();
-    employeeTable->setRowCount(employees.size());
-
-    for (size_t index = 0; index < employees.size(); ++index) {
-        const auto& employee = employees[index];
-        populateEmployeeRow(employeeTable, index, employee, currentCompany,
-                            mainWindow);
-
-        if (!employee->getIsActive()) {
-            setInactiveEmployeeStyle(employeeTable, index);
-        }
-    }
-}
-
-void DisplayHelper::displayProjects(QTableWidget* projectTable,
-                                    const Company* currentCompany,
-                                    MainWindow* mainWindow) {
-    if (currentCompany == nullptr || projectTable == nullptr) return;
-
-    auto projects = currentCompany->getAllProjects();
-    projectTable->setRowCount(projects.size());
-
-    for (size_t index = 0; index < projects.size(); ++index) {
-        const auto& project = projects[index];
-        projectTable->setItem(
-            index, 0, new QTableWidgetItem(QString::number(project.getId())));
-        projectTable->setItem(index, 1,
-                              new QTableWidgetItem(project.getName()));
-        projectTable->setItem(index, 2,
-                              new QTableWidgetItem(project.getPhase()));
-        projectTable->setItem(
-            index, 3,
-            new QTableWidgetItem(QString::number(project.getBudget(), 'f', 2)));
-        projectTable->setItem(
-            index, 4,
-            new QTableWidgetItem(QString::number(project.getEstimatedHours())));
-        projectTable->setItem(
-            index, 5,
-            new QTableWidgetItem(QString::number(project.getAllocatedHours())));
-        projectTable->setItem(index, 6,
-                              new QTableWidgetItem(project.getClientName()));
-
-        if (QWidget* actionWidget =
-                ActionButtonHelper::createProjectActionButtons(
-                    projectTable, static_cast<int>(index), mainWindow)) {
-            projectTable->setCellWidget(index, 7, actionWidget);
-        }
-    }
-}
-
 void DisplayHelper::showCompanyInfo(QTextEdit* companyInfoText,
                                     const Company* currentCompany) {
     if (currentCompany == nullptr || companyInfoText == nullptr) return;
@@ -345,8 +251,8 @@ void DisplayHelper::showStatistics(QTextEdit* statisticsText,
                                    const Company* currentCompany) {
     if (currentCompany == nullptr || statisticsText == nullptr) return;
 
-    auto employees = currentCompany->getAllEmployees();
-    auto projects = currentCompany->getAllProjects();
+    auto employees = currentCompany->getEmployeesView();
+    auto projects = currentCompany->getProjectsView();
 
     int totalEmployees = currentCompany->getEmployeeCount();
     int totalProjects = currentCompany->getProjectCount();
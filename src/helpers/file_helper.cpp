@@ -6,6 +6,7 @@
 #include <QWidget>
 #include <exception>
 
+#include "managers/auto_save_loader.h"
 #include "ui/main_window.h"
 
 void FileHelper::clearAllDataFiles(QWidget* parent) {
@@ -21,17 +22,21 @@ void FileHelper::clearAllDataFiles(QWidget* parent) {
     }
 
     try {
-        if (const MainWindow* mainWindow = qobject_cast<MainWindow*>(parent);
-            !mainWindow) {
+        auto* mainWindow = qobject_cast<MainWindow*>(parent);
+        if (!mainWindow) {
             return;
         }
+        if (mainWindow->autoSaver) {
+            mainWindow->autoSaver->waitForFinished();
+        }
+        AutoSaveLoader::ensureAllLoaded(mainWindow->companies, mainWindow);
 
         QString dataDirPath = MainWindow::getDataDirectory();
         QDir dataDir(dataDirPath);
 
         if (dataDir.exists()) {
             QStringList dirs = {"companies", "employees", "projects"};
-            QStringList filters{"*.txt"};
+            QStringList filters{"*.txt", "*.snap", "*.journal"};
 
             for (const QString& dirName : dirs) {
                 QDir subDir(dataDirPath + "/" + dirName);
@@ -45,6 +50,7 @@ void FileHelper::clearAllDataFiles(QWidget* parent) {
                 }
             }
 
+            AutoSaveLoader::discardPersistedState();
             QMessageBox::information(
                 parent, "Success",
                 "All data files have been cleared successfully.");
@@ -1,9 +1,14 @@
 #include "helpers/html_generator.h"
 
+#include <QStringList>
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <unordered_map>
 
 #include "entities/company.h"
 #include "entities/employee.h"
@@ -11,108 +16,102 @@
 #include "entities/task.h"
 #include "helpers/display_helper.h"
 
-QString HtmlGenerator::generateProjectDetailHtml(const Project& project,
-                                                 const Company* company) {
-    if (!company) return "";
-
-    QString phase = project.getPhase().trimmed();
-    bool projectCompleted =
-        phase.compare("Completed", Qt::CaseInsensitive) == 0;
-    QString projectName = project.getName().isEmpty()
-                              ? QString("Untitled project")
-                              : project.getName().toHtmlEscaped();
-    QString phaseLabel =
-        phase.isEmpty() ? QString("Phase not set") : phase.toHtmlEscaped();
-    QString badgeClass = projectCompleted
-                             ? QString("phase-badge phase-completed")
-                             : QString("phase-badge phase-active");
-    QString subtitle =
-        projectCompleted
-            ? QString("Team members who delivered this project")
-            : QString("Team members currently assigned to this project");
-
-    auto employees = company->getAllEmployees();
-    auto tasks = company->getProjectTasks(project.getId());
-
-    std::vector<std::shared_ptr<Employee>> projectEmployees;
-    for (const auto& employee : employees) {
-        if (employee == nullptr) {
-            continue;
-        }
-
-        bool isAssigned = employee->isAssignedToProject(project.getId());
-
-        bool wasOnProject = false;
-        const auto& projectHistory = employee->getProjectHistory();
-        if (auto it = std::ranges::find(projectHistory, project.getId());
-            it != projectHistory.end()) {
-            wasOnProject = true;
-        }
+// Everyone who is or was on each project, in employee order.
+using ProjectTeams =
+    std::unordered_map<int, std::vector<std::shared_ptr<Employee>>>;
+
+// Rendered project details and the team index they were built from. Both
+// belong to one model version; the first lookup under a newer version
+// starts over. Only the GUI thread renders these views.
+struct ProjectViewCache {
+    std::uint64_t modelVersion = 0;
+    std::optional<ProjectTeams> teams;
+    std::unordered_map<int, QString> detailHtml;
+};
+
+static constexpr qsizetype kDetailPageReserve = 6 * 1024;
+static constexpr qsizetype kTeamRowReserve = 640;
+
+static ProjectViewCache& projectViewCacheFor(const Company& company) {
+    static ProjectViewCache cache;
+    if (cache.modelVersion != company.getModelVersion()) {
+        cache = ProjectViewCache{company.getModelVersion(), {}, {}};
+    }
+    return cache;
+}
 
-        bool hasTaskAssignments = false;
-        for (const auto& task : tasks) {
-            if (company->getEmployeeHours(employee->getId(), project.getId(),
-                                          task.getId()) > 0) {
-                hasTaskAssignments = true;
-                break;
-            }
+static ProjectTeams buildProjectTeams(const Company& company) {
+    ProjectTeams teams;
+    const TaskAssignmentStore& assignments = company.getAssignmentStore();
+    std::vector<int> projectIds;
+    for (const auto& employee : company.getEmployeesView()) {
+        if (employee == nullptr) continue;
+
+        const auto& assigned = employee->getAssignedProjects();
+        const auto& history = employee->getProjectHistory();
+        projectIds.assign(assigned.begin(), assigned.end());
+        projectIds.insert(projectIds.end(), history.begin(), history.end());
+        assignments.forEachOfEmployee(
+            employee->getId(), [&projectIds](int projectId, int, int hours) {
+                if (hours > 0) projectIds.push_back(projectId);
+            });
+
+        std::ranges::sort(projectIds);
+        auto duplicates = std::ranges::unique(projectIds);
+        projectIds.erase(duplicates.begin(), duplicates.end());
+        for (int projectId : projectIds) {
+            teams[projectId].push_back(employee);
         }
+    }
+    return teams;
+}
 
-        if (!isAssigned && !wasOnProject && !hasTaskAssignments) {
-            continue;
-        }
+static const std::vector<std::shared_ptr<Employee>>& projectTeam(
+    const Company& company, int projectId) {
+    static const std::vector<std::shared_ptr<Employee>> kNoTeam;
+    ProjectViewCache& cache = projectViewCacheFor(company);
+    if (!cache.teams) {
+        cache.teams = buildProjectTeams(company);
+    }
+    auto found = cache.teams->find(projectId);
+    return found == cache.teams->end() ? kNoTeam : found->second;
+}
 
-        projectEmployees.push_back(employee);
+// Comma-separated names of the tasks each employee has hours on, in task
+// order, from one pass over the project's assignments.
+static std::unordered_map<int, QString> taskNamesByEmployee(
+    const Company& company, int projectId, std::span<const Task> tasks) {
+    std::unordered_map<int, size_t> taskPositions;
+    taskPositions.reserve(tasks.size());
+    for (size_t position = 0; position < tasks.size(); ++position) {
+        taskPositions.emplace(tasks[position].getId(), position);
     }
 
-    int teamCount = projectEmployees.size();
-    QString badges = QString("Team size: %1</span>").arg(teamCount);
+    std::unordered_map<int, std::vector<size_t>> positionsByEmployee;
+    company.getAssignmentStore().forEachOfProject(
+        projectId, [&](int employeeId, int taskId, int hours) {
+            if (hours <= 0) return;
+            if (auto found = taskPositions.find(taskId);
+                found != taskPositions.end()) {
+                positionsByEmployee[employeeId].push_back(found->second);
+            }
+        });
 
-    QString teamContent;
-    if (projectEmployees.empty()) {
-        teamContent =
-            QString("<div class='empty'>%1</div>")
-                .arg(
-                    projectCompleted
-                        ? QString(
-                              "No team members were recorded for this project.")
-                        : QString("No team members assigned yet. Use the "
-                                  "Assign button to add specialists."));
-    } else {
-        QString tableRowsHtml;
-        int rowNumber = 1;
-        for (const auto& employee : projectEmployees) {
-            tableRowsHtml += generateTeamTableRow(
-                employee, project, company, tasks, rowNumber, projectCompleted);
-            rowNumber++;
+    std::unordered_map<int, QString> names;
+    names.reserve(positionsByEmployee.size());
+    for (auto& [employeeId, positions] : positionsByEmployee) {
+        std::ranges::sort(positions);
+        QStringList employeeTasks;
+        for (size_t position : positions) {
+            employeeTasks.append(tasks[position].getName().toHtmlEscaped());
         }
-
-        teamContent = QString(R"(
-            <table class="team-table">
-                <thead>
-                    <tr>
-                        <th class="row-number">№</th>
-                        <th>Name</th>
-                        <th>Department</th>
-                        <th>Employee Type</th>
-                        <th>Status</th>
-                        <th>Tasks</th>
-                        <th>Weekly Capacity</th>
-                        <th>Allocated</th>
-                        <th>Free</th>
-                        <th>Employment</th>
-                        <th>Base Salary</th>
-                    </tr>
-                </thead>
-                <tbody>
-                    %1
-                </tbody>
-            </table>
-        )")
-                          .arg(tableRowsHtml);
+        names.emplace(employeeId, employeeTasks.join(", "));
     }
+    return names;
+}
 
-    QString html = QString(R"(
+static const QString& projectDetailHead() {
+    static const QString head = QString(R"(
         <html>
         <head>
             <style>
@@ -149,21 +148,99 @@ QString HtmlGenerator::generateProjectDetailHtml(const Project& project,
             <div class="wrapper">
                 <div class="header">
                     <div class="title-block">
-                        <div class="title">%1</div>
-                        <div class="subtitle">%2</div>
+                        <div class="title">)");
+    return head;
+}
+
+QString HtmlGenerator::generateProjectDetailHtml(const Project& project,
+                                                 const Company* company) {
+    if (!company) return "";
+
+    ProjectViewCache& cache = projectViewCacheFor(*company);
+    if (auto cached = cache.detailHtml.find(project.getId());
+        cached != cache.detailHtml.end()) {
+        return cached->second;
+    }
+
+    QString phase = project.getPhase().trimmed();
+    bool projectCompleted =
+        phase.compare("Completed", Qt::CaseInsensitive) == 0;
+    QString projectName = project.getName().isEmpty()
+                              ? QString("Untitled project")
+                              : project.getName().toHtmlEscaped();
+    QString subtitle =
+        projectCompleted
+            ? QString("Team members who delivered this project")
+            : QString("Team members currently assigned to this project");
+
+    const auto& projectEmployees = projectTeam(*company, project.getId());
+    auto tasks = company->getProjectTasksView(project.getId());
+
+    QString html;
+    html.reserve(kDetailPageReserve +
+                 static_cast<qsizetype>(projectEmployees.size()) *
+                     kTeamRowReserve);
+    html += projectDetailHead();
+    html += projectName;
+    html += R"(</div>
+                        <div class="subtitle">)";
+    html += subtitle;
+    html += R"(</div>
                     </div>
-                    <div class="header-badges">%3</div>
+                    <div class="header-badges">Team size: )";
+    html += QString::number(projectEmployees.size());
+    html += R"(</span></div>
                 </div>
-                %4
+                )";
+
+    if (projectEmployees.empty()) {
+        html += "<div class='empty'>";
+        html += projectCompleted
+                    ? "No team members were recorded for this project."
+                    : "No team members assigned yet. Use the Assign button "
+                      "to add specialists.";
+        html += "</div>";
+    } else {
+        html += R"(
+            <table class="team-table">
+                <thead>
+                    <tr>
+                        <th class="row-number">№</th>
+                        <th>Name</th>
+                        <th>Department</th>
+                        <th>Employee Type</th>
+                        <th>Status</th>
+                        <th>Tasks</th>
+                        <th>Weekly Capacity</th>
+                        <th>Allocated</th>
+                        <th>Free</th>
+                        <th>Employment</th>
+                        <th>Base Salary</th>
+                    </tr>
+                </thead>
+                <tbody>)";
+        auto taskNames = taskNamesByEmployee(*company, project.getId(), tasks);
+        int rowNumber = 1;
+        for (const auto& employee : projectEmployees) {
+            auto names = taskNames.find(employee->getId());
+            QString tasksDisplay =
+                names == taskNames.end() ? QString("-") : names->second;
+            appendTeamTableRow(html, *employee, project, company, tasksDisplay,
+                               rowNumber, projectCompleted);
+            rowNumber++;
+        }
+        html += R"(
+                </tbody>
+            </table>)";
+    }
+
+    html += R"(
             </div>
         </body>
         </html>
-    )")
-                       .arg(projectName)
-                       .arg(subtitle)
-                       .arg(badges)
-                       .arg(teamContent);
+    )";
 
+    cache.detailHtml.emplace(project.getId(), html);
     return html;
 }
 
@@ -183,47 +260,6 @@ static QString getTaskBadgeClass(const QString& taskType) {
     return "badge-info";
 }
 
-static bool employeeHasTaskAssignments(const Company* company, int employeeId,
-                                       int projectId,
-                                       const std::vector<Task>& tasks) {
-    return std::ranges::any_of(
-        tasks, [company, employeeId, projectId](const auto& task) {
-            return company->getEmployeeHours(employeeId, projectId,
-                                             task.getId()) > 0;
-        });
-}
-
-static void collectProjectEmployees(
-    const Company* company, int projectId, const std::vector<Task>& tasks,
-    std::vector<std::shared_ptr<Employee>>& projectEmployees) {
-    auto allEmployees = company->getAllEmployees();
-    for (const auto& emp : allEmployees) {
-        if (!emp) continue;
-
-        bool isAssigned = emp->isAssignedToProject(projectId);
-        bool wasOnProject =
-            std::ranges::find(emp->getProjectHistory(), projectId) !=
-            emp->getProjectHistory().end();
-        bool hasTaskAssignments =
-            employeeHasTaskAssignments(company, emp->getId(), projectId, tasks);
-
-        if (isAssigned || wasOnProject || hasTaskAssignments) {
-            projectEmployees.push_back(emp);
-        }
-    }
-}
-
-static int calculateProjectHoursForEmployee(const Company* company,
-                                            int employeeId, int projectId,
-                                            const std::vector<Task>& tasks) {
-    int projectHours = 0;
-    for (const auto& task : tasks) {
-        projectHours +=
-            company->getEmployeeHours(employeeId, projectId, task.getId());
-    }
-    return projectHours;
-}
-
 static QString generateProjectMetricsHtml(const Project& project) {
     int totalEstimated = project.getEstimatedHours();
     int totalAllocated = project.getAllocatedHours();
@@ -297,7 +333,7 @@ static QString generateProjectMetricsHtml(const Project& project) {
 }
 
 static QString generateTeamMembersHtml(
-    const Company* company, int projectId, const std::vector<Task>& tasks,
+    const Company* company, int projectId,
     const std::vector<std::shared_ptr<Employee>>& projectEmployees) {
     QString html = R"(<div class="section">)";
     html += QString(R"(<div class="section-title">Team Members (%1)</div>)")
@@ -309,8 +345,8 @@ static QString generateTeamMembersHtml(
     } else {
         for (const auto& emp : projectEmployees) {
             QString badgeClass = getEmployeeBadgeClass(emp->getEmployeeType());
-            int projectHours = calculateProjectHoursForEmployee(
-                company, emp->getId(), projectId, tasks);
+            int projectHours =
+                company->getEmployeeHours(emp->getId(), projectId);
 
             double projectUtilization = 0.0;
             if (emp->getWeeklyHoursCapacity() > 0) {
@@ -350,7 +386,7 @@ static QString generateTeamMembersHtml(
     return html;
 }
 
-static QString generateProjectTasksHtml(const std::vector<Task>& tasks) {
+static QString generateProjectTasksHtml(std::span<const Task> tasks) {
     QString html;
     html +=
         R"(<div style="margin-top: 12px; padding-top: 12px; border-top: 1px solid #e0e0e0;">)";
@@ -391,7 +427,7 @@ static QString generateProjectTasksHtml(const std::vector<Task>& tasks) {
     return html;
 }
 
-static QString generateTasksHtml(const std::vector<Task>& tasks) {
+static QString generateTasksHtml(std::span<const Task> tasks) {
     QString html = R"(<div class="section">)";
     html += QString(R"(<div class="section-title">Tasks (%1)</div>)")
                 .arg(tasks.size());
@@ -489,12 +525,9 @@ QString HtmlGenerator::generateProjectAssignmentsHtml(const Project& project,
 
     html += generateProjectMetricsHtml(project);
 
-    auto tasks = company->getProjectTasks(project.getId());
-    std::vector<std::shared_ptr<Employee>> projectEmployees;
-    collectProjectEmployees(company, project.getId(), tasks, projectEmployees);
-    html += generateTeamMembersHtml(company, project.getId(), tasks,
-                                    projectEmployees);
-    html += generateTasksHtml(tasks);
+    html += generateTeamMembersHtml(company, project.getId(),
+                                    projectTeam(*company, project.getId()));
+    html += generateTasksHtml(company->getProjectTasksView(project.getId()));
     html += R"(
         </body>
         </html>
@@ -699,7 +732,7 @@ QString HtmlGenerator::generateEmployeeHistoryHtml(
             R"(<div class="empty-state">This employee is not assigned to any projects yet.</div>)";
     } else {
         for (const auto* proj : employeeProjects) {
-            auto tasks = company->getProjectTasks(proj->getId());
+            auto tasks = company->getProjectTasksView(proj->getId());
 
             int projectEstimated = proj->getEstimatedHours();
             int projectAllocated = proj->getAllocatedHours();
@@ -761,11 +794,11 @@ QString HtmlGenerator::formatPercentText(double value) {
     return QString::number(rounded, 'f', 1);
 }
 
-QString HtmlGenerator::getEmployeeStatus(
-    const std::shared_ptr<Employee>& employee, const Project& project,
-    bool projectCompleted) {
-    bool isActiveEmployee = employee->getIsActive();
-    bool isCurrentlyAssigned = employee->isAssignedToProject(project.getId());
+QString HtmlGenerator::getEmployeeStatus(const Employee& employee,
+                                         const Project& project,
+                                         bool projectCompleted) {
+    bool isActiveEmployee = employee.getIsActive();
+    bool isCurrentlyAssigned = employee.isAssignedToProject(project.getId());
 
     if (projectCompleted) {
         return isActiveEmployee ? "Delivered · still employed"
@@ -776,73 +809,46 @@ QString HtmlGenerator::getEmployeeStatus(
     }
 }
 
-QString HtmlGenerator::getEmployeeTasksDisplay(
-    const std::shared_ptr<Employee>& employee, const Project& project,
-    const Company* company, const std::vector<Task>& tasks) {
-    QStringList employeeTasks;
-    for (const auto& task : tasks) {
-        int taskHours = company->getEmployeeHours(
-            employee->getId(), project.getId(), task.getId());
-        if (taskHours > 0) {
-            employeeTasks.append(task.getName().toHtmlEscaped());
-        }
-    }
-    return employeeTasks.isEmpty() ? "-" : employeeTasks.join(", ");
-}
-
-QString HtmlGenerator::generateTeamTableRow(
-    const std::shared_ptr<Employee>& employee, const Project& project,
-    const Company* company, const std::vector<Task>& tasks, int rowNumber,
-    bool projectCompleted) {
-    QString name = employee->getName().isEmpty()
-                       ? QString("Employee #%1").arg(employee->getId())
-                       : employee->getName();
-    name = name.toHtmlEscaped();
-
-    QString department = employee->getDepartment().trimmed();
-    QString departmentDisplay =
-        department.isEmpty() ? "-" : department.toHtmlEscaped();
-    QString employeeType = employee->getEmployeeType().toHtmlEscaped();
-    QString status = getEmployeeStatus(employee, project, projectCompleted);
-    QString tasksDisplay =
-        getEmployeeTasksDisplay(employee, project, company, tasks);
-
-    int capacity = std::max(employee->getWeeklyHoursCapacity(), 0);
+void HtmlGenerator::appendTeamTableRow(QString& html, const Employee& employee,
+                                       const Project& project,
+                                       const Company* company,
+                                       const QString& tasksDisplay,
+                                       int rowNumber, bool projectCompleted) {
+    QString name = employee.getName().isEmpty()
+                       ? QString("Employee #%1").arg(employee.getId())
+                       : employee.getName();
+
+    QString department = employee.getDepartment().trimmed();
+    int capacity = std::max(employee.getWeeklyHoursCapacity(), 0);
     int projectHours =
-        company->getEmployeeHours(employee->getId(), project.getId());
+        company->getEmployeeHours(employee.getId(), project.getId());
     int used = std::min(std::max(projectHours, 0), capacity);
-    int currentTotalHours = std::max(employee->getCurrentWeeklyHours(), 0);
+    int currentTotalHours = std::max(employee.getCurrentWeeklyHours(), 0);
     int available = std::max(capacity - currentTotalHours, 0);
 
-    QString employmentDisplay = QString("%1% FTE").arg(
-        formatPercentText(employee->getEmploymentRate()));
-    QString salaryDisplay =
-        QString("$%1").arg(QString::number(employee->getSalary(), 'f', 2));
-
-    return QString(R"(
+    html += R"(
         <tr>
-            <td class="row-number">%1</td>
-            <td>%2</td>
-            <td>%3</td>
-            <td>%4</td>
-            <td>%5</td>
-            <td>%6</td>
-            <td>%7h</td>
-            <td>%8h</td>
-            <td>%9h</td>
-            <td>%10</td>
-            <td>%11</td>
-        </tr>
-    )")
-        .arg(rowNumber)
-        .arg(name)
-        .arg(departmentDisplay)
-        .arg(employeeType)
-        .arg(status)
-        .arg(tasksDisplay)
-        .arg(capacity)
-        .arg(used)
-        .arg(available)
-        .arg(employmentDisplay)
-        .arg(salaryDisplay);
+            <td class="row-number">)";
+    html += QString::number(rowNumber);
+    html += "</td>\n            <td>";
+    html += name.toHtmlEscaped();
+    html += "</td>\n            <td>";
+    html += department.isEmpty() ? QString("-") : department.toHtmlEscaped();
+    html += "</td>\n            <td>";
+    html += employee.getEmployeeType().toHtmlEscaped();
+    html += "</td>\n            <td>";
+    html += getEmployeeStatus(employee, project, projectCompleted);
+    html += "</td>\n            <td>";
+    html += tasksDisplay;
+    html += "</td>\n            <td>";
+    html += QString::number(capacity);
+    html += "h</td>\n            <td>";
+    html += QString::number(used);
+    html += "h</td>\n            <td>";
+    html += QString::number(available);
+    html += "h</td>\n            <td>";
+    html += formatPercentText(employee.getEmploymentRate());
+    html += "% FTE</td>\n            <td>$";
+    html += QString::number(employee.getSalary(), 'f', 2);
+    html += "</td>\n        </tr>";
 }
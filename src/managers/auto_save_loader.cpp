@@ -2,21 +2,38 @@
 
 #include <QDir>
 #include <QFile>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QLoggingCategory>
 #include <QMessageBox>
+#include <QtConcurrent>
+#include <map>
 #include <ranges>
+#include <unordered_map>
+#include <utility>
 
+#include "managers/change_journal.h"
+#include "managers/company_snapshot.h"
 #include "managers/file_manager.h"
 #include "ui/main_window.h"
+#include "utils/consts.h"
 
-static bool hasEmployeeTaskAssignments(const Company& company, int employeeId,
-                                       int projectId) {
-    auto tasks = company.getProjectTasks(projectId);
-    return std::ranges::any_of(
-        tasks, [&company, employeeId, projectId](const auto& task) {
-            return company.getEmployeeHours(employeeId, projectId,
-                                            task.getId()) > 0;
-        });
-}
+Q_LOGGING_CATEGORY(autoSaveLoader, "auto.save.loader")
+
+// A fully loaded company and what its load-time normalization fixed.
+struct LoadedCompany {
+    Company* company = nullptr;
+    LoadNormalization normalization;
+};
+
+// Companies whose snapshot and journal files currently mirror them, in file
+// index order. While the list is unchanged an autosave only appends the
+// unsaved changes of each company to its journal.
+static std::vector<Company*> persistedCompanies;
+
+// Companies loaded at startup with only their company record, mapped to the
+// file index their employees and projects are still read from.
+static std::unordered_map<const Company*, QString> headerOnlyCompanies;
 
 static void saveCompanyFile(const Company* company, const QString& filePath,
                             MainWindow* mainWindow, const QString& errorMsg) {
@@ -30,6 +47,44 @@ static void saveCompanyFile(const Company* company, const QString& filePath,
     }
 }
 
+static bool needsFullSnapshot(const Company* company,
+                              const QString& snapshotFilePath,
+                              const QString& journalFilePath) {
+    return company->getUnsavedChanges().everything ||
+           !QFile::exists(snapshotFilePath) ||
+           !QFile::exists(journalFilePath) ||
+           QFileInfo(journalFilePath).size() > kJournalCompactionBytes;
+}
+
+static QStringList textFilePaths(const QString& dataDirPath,
+                                 const QString& index) {
+    QDir companiesDir(dataDirPath + "/companies");
+    QDir employeesDir(dataDirPath + "/employees");
+    QDir projectsDir(dataDirPath + "/projects");
+    return {
+        companiesDir.absoluteFilePath(QString("company_%1.txt").arg(index)),
+        employeesDir.absoluteFilePath(QString("employees_%1.txt").arg(index)),
+        projectsDir.absoluteFilePath(QString("projects_%1.txt").arg(index)),
+        projectsDir.absoluteFilePath(QString("tasks_%1.txt").arg(index)),
+        projectsDir.absoluteFilePath(
+            QString("task_assignments_%1.txt").arg(index))};
+}
+
+static void writeCompanyJob(const CompanySaveJob& job) {
+    if (!job.snapshot.empty()) {
+        ChangeJournal::reset(
+            job.journalFilePath,
+            CompanySnapshot::write(job.snapshot, job.snapshotFilePath));
+        for (const QString& filePath : job.supersededFilePaths) {
+            if (QFile::exists(filePath)) {
+                QFile::remove(filePath);
+            }
+        }
+    } else {
+        ChangeJournal::append(job.journalRecords, job.journalFilePath);
+    }
+}
+
 static void saveEmployeesFile(const Company* company, const QString& filePath,
                               MainWindow* mainWindow) {
     try {
@@ -97,26 +152,105 @@ static void loadCompanyFiles(Company& company, const QString& index,
     }
 }
 
-static void processInactiveEmployee(const std::shared_ptr<Employee>& emp,
-                                    const Company& company) {
-    auto assignedProjects = emp->getAssignedProjects();
-    auto allProjects = company.getAllProjects();
+static Company loadCompanyData(const QString& index, const QDir& companiesDir,
+                               const QDir& employeesDir,
+                               const QDir& projectsDir) {
+    if (QString snapshotFilePath = companiesDir.absoluteFilePath(
+            QString("company_%1.snap").arg(index));
+        QFile::exists(snapshotFilePath)) {
+        Company company = CompanySnapshot::load(snapshotFilePath);
+        ChangeJournal::replay(company,
+                              companiesDir.absoluteFilePath(
+                                  QString("company_%1.journal").arg(index)),
+                              CompanySnapshot::readChecksum(snapshotFilePath));
+        return company;
+    }
 
-    for (const auto& project : allProjects) {
-        int projectId = project.getId();
-        if (hasEmployeeTaskAssignments(company, emp->getId(), projectId)) {
-            emp->addToProjectHistory(projectId);
-        }
+    Company company = FileManager::loadCompany(
+        companiesDir.absoluteFilePath(QString("company_%1.txt").arg(index)));
+    loadCompanyFiles(company, index, employeesDir, projectsDir);
+    return company;
+}
+
+// Loads one company and brings it into a consistent state. Touches no
+// shared state, so several companies can be built at once. Data the model
+// rejects is reported as a FileManagerException like any other unreadable
+// file, so callers (and QtConcurrent workers) only have one type to catch.
+static Company loadFullCompany(const QString& index,
+                               const QString& dataDirPath,
+                               LoadNormalization& normalization) {
+    QDir companiesDir(dataDirPath + "/companies");
+    QDir employeesDir(dataDirPath + "/employees");
+    QDir projectsDir(dataDirPath + "/projects");
+
+    try {
+        QElapsedTimer timer;
+        timer.start();
+        Company company =
+            loadCompanyData(index, companiesDir, employeesDir, projectsDir);
+        double readMs = timer.nsecsElapsed() / 1e6;
+        timer.start();
+        normalization = company.normalizeLoadedData();
+        qCDebug(autoSaveLoader)
+            << "Loaded company" << index << "- read:" << readMs
+            << "ms, normalize:" << timer.nsecsElapsed() / 1e6 << "ms";
+        return company;
+    } catch (const FileManagerException&) {
+        throw;
+    } catch (const BaseException& e) {
+        throw FileManagerException("Invalid data for company " + index + ": " +
+                                   e.getMessage());
     }
+}
 
-    for (int projectId : assignedProjects) {
-        emp->addToProjectHistory(projectId);
+static LoadedCompany buildCompany(const QString& index,
+                                  const QString& dataDirPath) {
+    LoadedCompany loaded;
+    try {
+        loaded.company = new Company(
+            loadFullCompany(index, dataDirPath, loaded.normalization));
+    } catch (const FileManagerException&) {
+        loaded.company = nullptr;
     }
+    return loaded;
+}
+
+static Company* buildCompanyHeader(const QString& index,
+                                   const QString& dataDirPath) {
+    QDir companiesDir(dataDirPath + "/companies");
+
+    try {
+        if (QString snapshotFilePath = companiesDir.absoluteFilePath(
+                QString("company_%1.snap").arg(index));
+            QFile::exists(snapshotFilePath)) {
+            return new Company(CompanySnapshot::loadHeader(snapshotFilePath));
+        }
+        QString companyFilePath = companiesDir.absoluteFilePath(
+            QString("company_%1.txt").arg(index));
+        return new Company(FileManager::loadCompany(companyFilePath));
+    } catch (const BaseException&) {
+        return nullptr;
+    }
+}
 
-    if (emp->getCurrentWeeklyHours() > 0) {
-        int currentHours = emp->getCurrentWeeklyHours();
-        emp->removeWeeklyHours(currentHours);
+static void finishLoading(Company* company,
+                          const LoadNormalization& normalization,
+                          MainWindow* mainWindow) {
+    company->clearUnsavedChanges();
+    if (!mainWindow || normalization.clearedProjectHours.empty()) return;
+
+    QStringList warningMessages;
+    for (const auto& [projectId, hours] : normalization.clearedProjectHours) {
+        const Project* project = company->getProject(projectId);
+        warningMessages.append(
+            QString("Project '%1': Found allocated hours (%2h) but no "
+                    "assigned employees. Hours have been cleared.")
+                .arg(project ? project->getName() : QString::number(projectId),
+                     QString::number(hours)));
     }
+    QMessageBox::warning(
+        mainWindow, "Data Validation Warning",
+        "Data inconsistency detected:\n\n" + warningMessages.join("\n"));
 }
 
 QString AutoSaveLoader::getDataDirectory() {
@@ -137,16 +271,19 @@ QString AutoSaveLoader::getDataDirectory() {
     return dataDirPath;
 }
 
-void AutoSaveLoader::clearDataFiles(const QString& dataDirPath) {
+// Removes the saved data files of every company, except the paths in keep.
+static void removeDataFiles(const QString& dataDirPath,
+                            const QStringList& keep) {
     QDir companiesDir(dataDirPath + "/companies");
     QDir employeesDir(dataDirPath + "/employees");
     QDir projectsDir(dataDirPath + "/projects");
 
     const QStringList filters{"*.txt"};
 
-    companiesDir.setNameFilters(filters);
+    companiesDir.setNameFilters({"*.txt", "*.snap", "*.journal"});
     companiesDir.setFilter(QDir::Files);
     for (const QString& fileName : companiesDir.entryList()) {
+        if (keep.contains(companiesDir.absoluteFilePath(fileName))) continue;
         companiesDir.remove(fileName);
     }
 
@@ -167,8 +304,166 @@ void AutoSaveLoader::clearDataFiles(const QString& dataDirPath) {
     }
 }
 
+void AutoSaveLoader::clearDataFiles(const QString& dataDirPath) {
+    removeDataFiles(dataDirPath, {});
+}
+
+AutoSavePlan AutoSaveLoader::captureChanges(
+    const std::vector<Company*>& companies) {
+    AutoSavePlan plan;
+    plan.dataDirPath = getDataDirectory();
+    QDir companiesDir(plan.dataDirPath + "/companies");
+
+    // Companies appended since the last save get new files of their own;
+    // any other change renumbers the files, so they are all rewritten.
+    bool layoutChanged =
+        persistedCompanies.empty() ||
+        companies.size() < persistedCompanies.size() ||
+        !std::ranges::equal(persistedCompanies,
+                            companies | std::views::take(
+                                            persistedCompanies.size()));
+    // Rewriting the layout clears every file, so it waits until each company
+    // can be written in full.
+    if (layoutChanged && !ensureAllLoaded(companies, nullptr)) {
+        plan.errors << "Failed to load company data; files were left as they "
+                       "are";
+        return plan;
+    }
+    plan.clearFiles =
+        layoutChanged &&
+        std::ranges::any_of(companies, [](const auto* company) {
+            return company != nullptr;
+        });
+
+    for (size_t i = 0; i < companies.size(); ++i) {
+        Company* company = companies[i];
+        if (company == nullptr || headerOnlyCompanies.contains(company)) {
+            continue;
+        }
+
+        QString index = QString::number(i + 1);
+        CompanySaveJob job;
+        job.snapshotFilePath = companiesDir.absoluteFilePath(
+            QString("company_%1.snap").arg(index));
+        job.journalFilePath = companiesDir.absoluteFilePath(
+            QString("company_%1.journal").arg(index));
+
+        if (layoutChanged || needsFullSnapshot(company, job.snapshotFilePath,
+                                               job.journalFilePath)) {
+            job.snapshot = CompanySnapshot::encode(*company);
+            job.supersededFilePaths = textFilePaths(plan.dataDirPath, index);
+        } else {
+            job.journalRecords =
+                ChangeJournal::encode(*company, company->getUnsavedChanges());
+            if (job.journalRecords.empty()) continue;
+        }
+        company->clearUnsavedChanges();
+        plan.jobs.push_back(std::move(job));
+    }
+
+    persistedCompanies = companies;
+    return plan;
+}
+
+QStringList AutoSaveLoader::writeChanges(const AutoSavePlan& plan) {
+    QStringList errors = plan.errors;
+    if (!errors.isEmpty()) return errors;
+    if (QDir companiesDir(plan.dataDirPath + "/companies");
+        !companiesDir.exists()) {
+        companiesDir.mkpath(".");
+    }
+
+    for (const CompanySaveJob& job : plan.jobs) {
+        try {
+            writeCompanyJob(job);
+        } catch (const FileManagerException& e) {
+            errors << QString("Failed to save company snapshot: %1")
+                          .arg(e.what());
+        }
+    }
+
+    // Files left over from the old layout are removed only once every new
+    // snapshot is on disk, so a crash mid-save never leaves a company
+    // without files.
+    if (plan.clearFiles && errors.isEmpty()) {
+        QStringList written;
+        for (const CompanySaveJob& job : plan.jobs) {
+            written << job.snapshotFilePath << job.journalFilePath;
+        }
+        removeDataFiles(plan.dataDirPath, written);
+    }
+    return errors;
+}
+
+void AutoSaveLoader::discardPersistedState() { persistedCompanies.clear(); }
+
+void AutoSaveLoader::ensureLoaded(Company* company, MainWindow* mainWindow) {
+    auto it = headerOnlyCompanies.find(company);
+    if (it == headerOnlyCompanies.end()) return;
+
+    // The company stays header-only until its data is in place, so a failed
+    // read never lets an autosave write it out empty.
+    LoadNormalization normalization;
+    *company = loadFullCompany(it->second, getDataDirectory(), normalization);
+    headerOnlyCompanies.erase(it);
+    finishLoading(company, normalization, mainWindow);
+}
+
+bool AutoSaveLoader::ensureAllLoaded(const std::vector<Company*>& companies,
+                                     MainWindow* mainWindow) {
+    std::vector<std::pair<Company*, QString>> pending;
+    for (Company* company : companies) {
+        if (auto it = headerOnlyCompanies.find(company);
+            it != headerOnlyCompanies.end()) {
+            pending.emplace_back(company, it->second);
+        }
+    }
+    if (pending.empty()) return true;
+
+    QString dataDirPath = getDataDirectory();
+    auto builtCompanies =
+        QtConcurrent::blockingMapped<std::vector<LoadedCompany>>(
+            pending, [&dataDirPath](const auto& entry) {
+                return buildCompany(entry.second, dataDirPath);
+            });
+
+    bool allLoaded = true;
+    for (size_t i = 0; i < pending.size(); ++i) {
+        const LoadedCompany& built = builtCompanies[i];
+        if (built.company == nullptr) {
+            allLoaded = false;
+            continue;
+        }
+        *pending[i].first = std::move(*built.company);
+        delete built.company;
+        headerOnlyCompanies.erase(pending[i].first);
+        finishLoading(pending[i].first, built.normalization, mainWindow);
+    }
+    return allLoaded;
+}
+
 void AutoSaveLoader::autoSave(const std::vector<Company*>& companies,
-                              MainWindow* mainWindow) {
+                              MainWindow* mainWindow, AutoSaveFormat format) {
+    if (format == AutoSaveFormat::Snapshot) {
+        if (QStringList errors = writeChanges(captureChanges(companies));
+            !errors.isEmpty()) {
+            discardPersistedState();
+            if (mainWindow) {
+                QMessageBox::warning(mainWindow, "Auto-save Error",
+                                     errors.join('\n'));
+            }
+        }
+        return;
+    }
+
+    if (!ensureAllLoaded(companies, mainWindow)) {
+        if (mainWindow) {
+            QMessageBox::warning(mainWindow, "Auto-save Error",
+                                 "Failed to load company data; files were "
+                                 "left as they are");
+        }
+        return;
+    }
     try {
         QString dataDirPath = getDataDirectory();
         if (QDir dataDir(dataDirPath); !dataDir.exists()) {
@@ -212,6 +507,7 @@ void AutoSaveLoader::autoSave(const std::vector<Company*>& companies,
                 QString("tasks_%1.txt").arg(index));
             saveTasksFile(companies[i], tasksFilePath, mainWindow);
         }
+        persistedCompanies.clear();
     } catch (const FileManagerException& e) {
         if (mainWindow) {
             QMessageBox::warning(
@@ -227,67 +523,92 @@ void AutoSaveLoader::autoLoad(std::vector<Company*>& companies,
                               MainWindow* mainWindow) {
     QString dataDirPath = getDataDirectory();
     QDir companiesDir(dataDirPath + "/companies");
-    QDir employeesDir(dataDirPath + "/employees");
-    QDir projectsDir(dataDirPath + "/projects");
 
     if (!companiesDir.exists()) return;
 
-    companiesDir.setNameFilters(QStringList() << "company_*.txt");
+    companiesDir.setNameFilters(QStringList() << "company_*.txt"
+                                              << "company_*.snap");
     companiesDir.setFilter(QDir::Files);
     QStringList companyFiles = companiesDir.entryList(QDir::Files, QDir::Name);
 
     if (companyFiles.isEmpty()) return;
 
-    std::vector<Company*> loadedCompanies;
-
+    // Ordered by number rather than by name, so company_10 follows company_9.
+    std::map<int, QString> indexByNumber;
     for (const QString& fileName : companyFiles) {
         QString index = fileName;
-        index.replace("company_", "").replace(".txt", "");
+        index.replace("company_", "").replace(".txt", "").replace(".snap", "");
         bool conversionOk = false;
-        [[maybe_unused]] int companyIndex = index.toInt(&conversionOk);
-        if (!conversionOk) continue;
-
-        try {
-            QString companyFilePath = companiesDir.absoluteFilePath(fileName);
-            Company company = FileManager::loadCompany(companyFilePath);
-
-            loadCompanyFiles(company, index, employeesDir, projectsDir);
-
-            company.recalculateEmployeeHours();
-            company.fixTaskAssignmentsToCapacity();
-            company.recalculateTaskAllocatedHours();
+        int companyIndex = index.toInt(&conversionOk);
+        if (conversionOk) {
+            indexByNumber.try_emplace(companyIndex, index);
+        }
+    }
 
-            auto employees = company.getAllEmployees();
-            for (const auto& emp : employees) {
-                if (!emp) continue;
+    std::vector<QString> indexes;
+    std::vector<int> fileIndexes;
+    for (const auto& [companyIndex, index] : indexByNumber) {
+        indexes.push_back(index);
+        fileIndexes.push_back(companyIndex);
+    }
 
-                auto it =
-                    FileManager::employeeStatusesFromFile.find(emp->getId());
-                if (it == FileManager::employeeStatusesFromFile.end()) {
-                    continue;
-                }
+    QElapsedTimer timer;
+    timer.start();
+    auto headers = QtConcurrent::blockingMapped<std::vector<Company*>>(
+        indexes, [&dataDirPath](const QString& index) {
+            return buildCompanyHeader(index, dataDirPath);
+        });
+    qCDebug(autoSaveLoader) << "Read" << headers.size()
+                            << "company headers in" << timer.elapsed() << "ms";
 
-                bool shouldBeActive = it->second;
-                emp->setIsActive(shouldBeActive);
+    std::vector<Company*> loadedCompanies;
+    bool filesMatchCompanies = true;
 
-                if (!shouldBeActive) {
-                    processInactiveEmployee(emp, company);
-                }
-            }
-            FileManager::employeeStatusesFromFile.clear();
+    for (size_t i = 0; i < headers.size(); ++i) {
+        Company* company = headers[i];
+        if (company == nullptr) {
+            filesMatchCompanies = false;
+            continue;
+        }
 
-            if (mainWindow) {
-                mainWindow->validateAndFixProjectAssignments(&company);
-            }
+        company->clearUnsavedChanges();
+        headerOnlyCompanies[company] = indexes[i];
+        loadedCompanies.push_back(company);
+        filesMatchCompanies =
+            filesMatchCompanies &&
+            fileIndexes[i] == static_cast<int>(loadedCompanies.size());
+    }
 
-            auto* companyPtr = new Company(std::move(company));
-            loadedCompanies.push_back(companyPtr);
+    // Only the company shown first is read in full; the others are read
+    // when they are selected or before their files are rewritten.
+    while (!loadedCompanies.empty()) {
+        try {
+            ensureLoaded(loadedCompanies.front(), mainWindow);
+            break;
         } catch (const FileManagerException&) {
-            continue;
+            headerOnlyCompanies.erase(loadedCompanies.front());
+            delete loadedCompanies.front();
+            loadedCompanies.erase(loadedCompanies.begin());
+            filesMatchCompanies = false;
         }
     }
+    // The files are renumbered on the next save, so a company that cannot be
+    // read in full is dropped now rather than kept as an empty record.
+    if (!filesMatchCompanies &&
+        !ensureAllLoaded(loadedCompanies, mainWindow)) {
+        std::erase_if(loadedCompanies, [](Company* company) {
+            if (headerOnlyCompanies.erase(company) == 0) return false;
+            delete company;
+            return true;
+        });
+    }
 
     companies = loadedCompanies;
+    if (filesMatchCompanies) {
+        persistedCompanies = companies;
+    } else {
+        persistedCompanies.clear();
+    }
     if (!companies.empty()) {
         currentCompany = companies[0];
         currentCompanyIndex = 0;
@@ -0,0 +1,65 @@
+#include "managers/background_auto_saver.h"
+
+#include <QtConcurrent>
+
+#include "managers/auto_save_loader.h"
+
+BackgroundAutoSaver::BackgroundAutoSaver(
+    const std::vector<Company*>& companies, QObject* parent)
+    : QObject(parent), companies(companies) {
+    connect(&watcher, &QFutureWatcher<QStringList>::finished, this,
+            &BackgroundAutoSaver::handleSaveFinished);
+}
+
+BackgroundAutoSaver::~BackgroundAutoSaver() { watcher.waitForFinished(); }
+
+void BackgroundAutoSaver::requestSave() {
+    if (saveRunning) {
+        savePending = true;
+        return;
+    }
+    startSave();
+}
+
+void BackgroundAutoSaver::waitForFinished() {
+    watcher.waitForFinished();
+    collectResult();
+}
+
+void BackgroundAutoSaver::flush() {
+    waitForFinished();
+    savePending = false;
+
+    if (QStringList errors = AutoSaveLoader::writeChanges(
+            AutoSaveLoader::captureChanges(companies));
+        !errors.isEmpty()) {
+        AutoSaveLoader::discardPersistedState();
+        emit saveFailed(errors.join('\n'));
+    }
+}
+
+void BackgroundAutoSaver::startSave() {
+    savePending = false;
+    saveRunning = true;
+    watcher.setFuture(QtConcurrent::run(
+        [plan = AutoSaveLoader::captureChanges(companies)] {
+            return AutoSaveLoader::writeChanges(plan);
+        }));
+}
+
+void BackgroundAutoSaver::collectResult() {
+    if (!saveRunning) return;
+    saveRunning = false;
+
+    if (QStringList errors = watcher.result(); !errors.isEmpty()) {
+        AutoSaveLoader::discardPersistedState();
+        emit saveFailed(errors.join('\n'));
+    }
+}
+
+void BackgroundAutoSaver::handleSaveFinished() {
+    collectResult();
+    if (savePending) {
+        startSave();
+    }
+}
@@ -0,0 +1,464 @@
+#include "managers/change_journal.h"
+
+#include <QByteArray>
+#include <QDate>
+#include <QFile>
+#include <QLoggingCategory>
+#include <array>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "entities/derived_employees.h"
+#include "exceptions/exceptions.h"
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+Q_LOGGING_CATEGORY(changeJournal, "change.journal")
+
+// Layout: a header naming the snapshot the journal applies to, followed by
+// records framed as [payload size][kind][payload][checksum]. A record that
+// is cut short or fails its checksum ends the journal; it is what a crash
+// in the middle of an append leaves behind.
+enum class JournalRecord : std::uint32_t {
+    EmployeeUpsert,
+    EmployeeRemove,
+    ProjectUpsert,
+    ProjectRemove
+};
+
+static constexpr std::array<char, 8> kJournalMagic{'C', 'O', 'M', 'P',
+                                                   'J', 'R', 'N', 'L'};
+static constexpr std::size_t kJournalHeaderSize = 24;
+static constexpr std::size_t kRecordHeaderSize = 8;
+static constexpr std::size_t kRecordChecksumSize = 8;
+
+static std::uint64_t computeChecksum(std::string_view bytes) {
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (char byte : bytes) {
+        hash ^= static_cast<unsigned char>(byte);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+template <typename T>
+static void appendValue(std::string& bytes, T value) {
+    bytes.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static T readValue(const char* position) {
+    T value;
+    std::memcpy(&value, position, sizeof(T));
+    return value;
+}
+
+class RecordWriter {
+   public:
+    explicit RecordWriter(JournalRecord recordKind) : kind(recordKind) {}
+
+    template <typename T>
+    void write(T value) {
+        appendValue(payload, value);
+    }
+
+    void writeString(const QString& text) {
+        auto utf8 = text.toUtf8();
+        write(static_cast<std::uint32_t>(utf8.size()));
+        payload.append(utf8.constData(), static_cast<std::size_t>(utf8.size()));
+    }
+
+    void appendTo(std::string& journal) const {
+        std::size_t start = journal.size();
+        appendValue(journal, static_cast<std::uint32_t>(payload.size()));
+        appendValue(journal, kind);
+        journal += payload;
+        std::string_view framed(journal);
+        appendValue(journal, computeChecksum(framed.substr(start + 4)));
+    }
+
+   private:
+    JournalRecord kind;
+    std::string payload;
+};
+
+class RecordReader {
+   public:
+    explicit RecordReader(std::string_view recordPayload)
+        : payload(recordPayload) {}
+
+    template <typename T>
+    T read() {
+        return readValue<T>(take(sizeof(T)).data());
+    }
+
+    QString readString() {
+        auto size = read<std::uint32_t>();
+        std::string_view text = take(size);
+        return QString::fromUtf8(text.data(),
+                                 static_cast<qsizetype>(text.size()));
+    }
+
+   private:
+    std::string_view take(std::size_t size) {
+        if (size > payload.size() - position) {
+            throw FileManagerException("Journal record is truncated");
+        }
+        std::string_view taken = payload.substr(position, size);
+        position += size;
+        return taken;
+    }
+
+    std::string_view payload;
+    std::size_t position = 0;
+};
+
+static void syncToDisk(QFile& file) {
+    file.flush();
+#ifdef Q_OS_WIN
+    _commit(file.handle());
+#else
+    ::fsync(file.handle());
+#endif
+}
+
+static bool hasJournalHeader(std::string_view bytes) {
+    return bytes.size() >= kJournalHeaderSize &&
+           std::memcmp(bytes.data(), kJournalMagic.data(),
+                       kJournalMagic.size()) == 0 &&
+           readValue<std::uint32_t>(bytes.data() + 8) ==
+               ChangeJournal::kFormatVersion;
+}
+
+static void writeEmployeeRecord(std::string& journal, const Company& company,
+                                const Employee& employee) {
+    RecordWriter record(JournalRecord::EmployeeUpsert);
+    record.write<std::int32_t>(employee.getId());
+    record.write(static_cast<std::uint8_t>(employee.getTypeCode()));
+    record.write<std::uint8_t>(employee.getIsActive());
+    record.writeString(employee.getName());
+    record.write(employee.getSalary());
+    record.writeString(employee.getDepartment());
+    record.write(employee.getEmploymentRate());
+
+    if (const auto* manager = dynamic_cast<const Manager*>(&employee)) {
+        record.write<std::int32_t>(manager->getManagedProjectId());
+    } else if (const auto* developer =
+                   dynamic_cast<const Developer*>(&employee)) {
+        record.writeString(developer->getProgrammingLanguage());
+        record.write(developer->getYearsOfExperience());
+    } else if (const auto* designer =
+                   dynamic_cast<const Designer*>(&employee)) {
+        record.writeString(designer->getDesignTool());
+        record.write<std::int32_t>(designer->getNumberOfProjects());
+    } else if (const auto* qaEmployee = dynamic_cast<const QA*>(&employee)) {
+        record.writeString(qaEmployee->getTestingType());
+        record.write<std::int32_t>(qaEmployee->getBugsFound());
+    }
+
+    std::vector<std::tuple<int, int, int>> assignments;
+    company.getAssignmentStore().forEachOfEmployee(
+        employee.getId(), [&assignments](int projectId, int taskId, int hours) {
+            assignments.emplace_back(projectId, taskId, hours);
+        });
+    record.write(static_cast<std::uint32_t>(assignments.size()));
+    for (const auto& [projectId, taskId, hours] : assignments) {
+        record.write<std::int32_t>(projectId);
+        record.write<std::int32_t>(taskId);
+        record.write<std::int32_t>(hours);
+    }
+    record.appendTo(journal);
+}
+
+static void writeProjectRecord(std::string& journal, const Company& company,
+                               const Project& project) {
+    RecordWriter record(JournalRecord::ProjectUpsert);
+    record.write<std::int32_t>(project.getId());
+    record.writeString(project.getName());
+    record.writeString(project.getDescription());
+    record.writeString(project.getPhase());
+    record.write<std::int64_t>(project.getStartDate().toJulianDay());
+    record.write<std::int64_t>(project.getEndDate().toJulianDay());
+    record.write(project.getBudget());
+    record.writeString(project.getClientName());
+    record.write<std::int32_t>(project.getInitialEstimatedHours());
+
+    record.write(static_cast<std::uint32_t>(project.getTasks().size()));
+    for (const auto& task : project.getTasks()) {
+        record.write<std::int32_t>(task.getId());
+        record.writeString(task.getName());
+        record.writeString(task.getType());
+        record.write<std::int32_t>(task.getEstimatedHours());
+        record.write<std::int32_t>(task.getAllocatedHours());
+        record.write<std::int32_t>(task.getPriority());
+        record.writeString(task.getPhase());
+    }
+
+    std::vector<std::tuple<int, int, int>> assignments;
+    company.getAssignmentStore().forEachOfProject(
+        project.getId(),
+        [&assignments](int employeeId, int taskId, int hours) {
+            assignments.emplace_back(employeeId, taskId, hours);
+        });
+    record.write(static_cast<std::uint32_t>(assignments.size()));
+    for (const auto& [employeeId, taskId, hours] : assignments) {
+        record.write<std::int32_t>(employeeId);
+        record.write<std::int32_t>(taskId);
+        record.write<std::int32_t>(hours);
+    }
+    record.appendTo(journal);
+}
+
+static void writeRemovalRecord(std::string& journal, JournalRecord kind,
+                               int id) {
+    RecordWriter record(kind);
+    record.write<std::int32_t>(id);
+    record.appendTo(journal);
+}
+
+static std::shared_ptr<Employee> readEmployee(RecordReader& record) {
+    auto id = record.read<std::int32_t>();
+    auto type = static_cast<EmployeeType>(record.read<std::uint8_t>());
+    bool isActive = record.read<std::uint8_t>() != 0;
+    QString name = record.readString();
+    auto salary = record.read<double>();
+    QString department = record.readString();
+    auto employmentRate = record.read<double>();
+
+    std::shared_ptr<Employee> employee;
+    switch (type) {
+        case EmployeeType::Manager:
+            employee = std::make_shared<Manager>(
+                id, name, salary, department, record.read<std::int32_t>(),
+                employmentRate);
+            break;
+        case EmployeeType::Developer: {
+            QString language = record.readString();
+            employee = std::make_shared<Developer>(
+                id, name, salary, department, language, record.read<double>(),
+                employmentRate);
+            break;
+        }
+        case EmployeeType::Designer: {
+            QString tool = record.readString();
+            employee = std::make_shared<Designer>(
+                id, name, salary, department, tool,
+                record.read<std::int32_t>(), employmentRate);
+            break;
+        }
+        case EmployeeType::QA: {
+            QString testingType = record.readString();
+            employee = std::make_shared<QA>(id, name, salary, department,
+                                            testingType,
+                                            record.read<std::int32_t>(),
+                                            employmentRate);
+            break;
+        }
+        case EmployeeType::Unknown:
+            throw FileManagerException("Unknown employee type in journal");
+    }
+    employee->setIsActive(isActive);
+    return employee;
+}
+
+static void replayEmployeeUpsert(Company& company, RecordReader& record) {
+    std::shared_ptr<Employee> employee = readEmployee(record);
+    int employeeId = employee->getId();
+    company.replaceEmployee(employee);
+
+    auto assignmentCount = record.read<std::uint32_t>();
+    for (std::uint32_t i = 0; i < assignmentCount; ++i) {
+        auto projectId = record.read<std::int32_t>();
+        auto taskId = record.read<std::int32_t>();
+        auto hours = record.read<std::int32_t>();
+        company.restoreTaskAssignment(employeeId, projectId, taskId, hours);
+    }
+}
+
+static void replayProjectUpsert(Company& company, RecordReader& record) {
+    auto projectId = record.read<std::int32_t>();
+    QString name = record.readString();
+    QString description = record.readString();
+    QString phase = record.readString();
+    QDate startDate = QDate::fromJulianDay(record.read<std::int64_t>());
+    QDate endDate = QDate::fromJulianDay(record.read<std::int64_t>());
+    auto budget = record.read<double>();
+    QString clientName = record.readString();
+    auto estimatedHours = record.read<std::int32_t>();
+
+    ProjectParams projectParams{projectId, name,   description,
+                                phase,     startDate, endDate,
+                                budget,    clientName, estimatedHours};
+    Project project(projectParams);
+
+    auto taskCount = record.read<std::uint32_t>();
+    for (std::uint32_t i = 0; i < taskCount; ++i) {
+        auto taskId = record.read<std::int32_t>();
+        QString taskName = record.readString();
+        QString taskType = record.readString();
+        auto taskEstimated = record.read<std::int32_t>();
+        auto taskAllocated = record.read<std::int32_t>();
+        auto priority = record.read<std::int32_t>();
+        QString taskPhase = record.readString();
+
+        Task task(taskId, taskName, taskType, taskEstimated, priority);
+        task.setPhase(taskPhase);
+        task.setAllocatedHours(taskAllocated);
+        project.getTasks().push_back(task);
+    }
+    project.recomputeTotalsFromTasks();
+
+    company.replaceProject(project);
+
+    auto assignmentCount = record.read<std::uint32_t>();
+    for (std::uint32_t i = 0; i < assignmentCount; ++i) {
+        auto employeeId = record.read<std::int32_t>();
+        auto taskId = record.read<std::int32_t>();
+        auto hours = record.read<std::int32_t>();
+        company.restoreTaskAssignment(employeeId, projectId, taskId, hours);
+    }
+}
+
+static void replayRecord(Company& company, JournalRecord kind,
+                         RecordReader& record) {
+    switch (kind) {
+        case JournalRecord::EmployeeUpsert:
+            replayEmployeeUpsert(company, record);
+            break;
+        case JournalRecord::EmployeeRemove:
+            company.removeEmployee(record.read<std::int32_t>());
+            break;
+        case JournalRecord::ProjectUpsert:
+            replayProjectUpsert(company, record);
+            break;
+        case JournalRecord::ProjectRemove:
+            company.removeProject(record.read<std::int32_t>());
+            break;
+        default:
+            throw FileManagerException("Unknown journal record kind");
+    }
+}
+
+void ChangeJournal::reset(const QString& fileName,
+                          std::uint64_t snapshotChecksum) {
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        throw FileManagerException("Cannot open file for writing: " + fileName);
+    }
+
+    std::string header(kJournalMagic.data(), kJournalMagic.size());
+    appendValue(header, kFormatVersion);
+    appendValue<std::uint32_t>(header, 0);
+    appendValue(header, snapshotChecksum);
+    if (file.write(header.data(), static_cast<qint64>(header.size())) !=
+        static_cast<qint64>(header.size())) {
+        throw FileManagerException("Error writing journal header: " +
+                                   fileName);
+    }
+    syncToDisk(file);
+}
+
+std::string ChangeJournal::encode(const Company& company,
+                                  const UnsavedChanges& changes) {
+    std::string records;
+    for (int projectId : changes.projects) {
+        if (const Project* project = company.getProject(projectId)) {
+            writeProjectRecord(records, company, *project);
+        } else {
+            writeRemovalRecord(records, JournalRecord::ProjectRemove,
+                               projectId);
+        }
+    }
+    for (int employeeId : changes.employees) {
+        if (auto employee = company.getEmployee(employeeId)) {
+            writeEmployeeRecord(records, company, *employee);
+        } else {
+            writeRemovalRecord(records, JournalRecord::EmployeeRemove,
+                               employeeId);
+        }
+    }
+    return records;
+}
+
+void ChangeJournal::append(const std::string& records,
+                           const QString& fileName) {
+    if (records.empty()) {
+        return;
+    }
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadWrite)) {
+        throw FileManagerException("Cannot open file for writing: " + fileName);
+    }
+    if (QByteArray header = file.read(kJournalHeaderSize);
+        !hasJournalHeader({header.constData(),
+                           static_cast<std::size_t>(header.size())})) {
+        throw FileManagerException("Journal has no valid header: " + fileName);
+    }
+
+    file.seek(file.size());
+    if (file.write(records.data(), static_cast<qint64>(records.size())) !=
+        static_cast<qint64>(records.size())) {
+        throw FileManagerException("Error appending to journal: " + fileName);
+    }
+    syncToDisk(file);
+}
+
+void ChangeJournal::replay(Company& company, const QString& fileName,
+                           std::uint64_t snapshotChecksum) {
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        reset(fileName, snapshotChecksum);
+        return;
+    }
+    QByteArray contents = file.readAll();
+    file.close();
+
+    std::string_view bytes(contents.constData(),
+                           static_cast<std::size_t>(contents.size()));
+    if (!hasJournalHeader(bytes) ||
+        readValue<std::uint64_t>(bytes.data() + 16) != snapshotChecksum) {
+        reset(fileName, snapshotChecksum);
+        return;
+    }
+
+    TaskAssignmentManager::BulkLoad bulkLoad(company.getTaskManager());
+    std::size_t position = kJournalHeaderSize;
+    while (bytes.size() - position >= kRecordHeaderSize + kRecordChecksumSize) {
+        auto payloadSize = readValue<std::uint32_t>(bytes.data() + position);
+        std::size_t recordSize =
+            kRecordHeaderSize + payloadSize + kRecordChecksumSize;
+        if (recordSize > bytes.size() - position) break;
+
+        std::string_view checked =
+            bytes.substr(position + 4, 4 + std::size_t{payloadSize});
+        if (readValue<std::uint64_t>(checked.data() + checked.size()) !=
+            computeChecksum(checked)) {
+            break;
+        }
+
+        auto kind = readValue<JournalRecord>(checked.data());
+        RecordReader record(checked.substr(4));
+        try {
+            replayRecord(company, kind, record);
+        } catch (const BaseException& e) {
+            qCWarning(changeJournal)
+                << "Skipping journal record:" << e.getMessage();
+        }
+        position += recordSize;
+    }
+
+    if (position < bytes.size()) {
+        qCWarning(changeJournal)
+            << "Dropping" << bytes.size() - position
+            << "bytes of incomplete journal records from" << fileName;
+        QFile::resize(fileName, static_cast<qint64>(position));
+    }
+}
@@ -0,0 +1,791 @@
+#include "managers/company_snapshot.h"
+
+#include <QByteArray>
+#include <QDate>
+#include <QFile>
+#include <QSaveFile>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "entities/derived_employees.h"
+#include "exceptions/exceptions.h"
+
+// Layout: a fixed header, a directory with one entry per section, then the
+// sections themselves. Each section holds rowCount values per column, with
+// the columns laid out one after another and padded to kAlignment bytes.
+// All values are little-endian; the checksum covers everything after the
+// header.
+enum class SnapshotSection : std::uint32_t {
+    Company,
+    Employees,
+    Projects,
+    Tasks,
+    Assignments,
+    Strings
+};
+
+static constexpr std::size_t kSnapshotSectionCount =
+    static_cast<std::size_t>(SnapshotSection::Strings) + 1;
+
+static constexpr std::array<char, 8> kSnapshotMagic{'C', 'O', 'M', 'P',
+                                                    'S', 'N', 'A', 'P'};
+static constexpr std::uint32_t kByteOrderMark = 0x01020304;
+static constexpr std::size_t kHeaderSize = 40;
+static constexpr std::size_t kPayloadSizeOffset = 24;
+static constexpr std::size_t kChecksumOffset = 32;
+static constexpr std::size_t kSectionEntrySize = 24;
+static constexpr std::size_t kAlignment = 8;
+
+struct SectionEntry {
+    std::uint32_t rowCount = 0;
+    std::uint64_t offset = 0;
+    std::uint64_t size = 0;
+};
+
+using SectionDirectory = std::array<SectionEntry, kSnapshotSectionCount>;
+
+struct EmployeeDetails {
+    QString text;
+    int number = 0;
+    double real = 0.0;
+};
+
+static constexpr std::size_t alignedSize(std::size_t size) {
+    return (size + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+template <typename T>
+static T readValue(const std::byte* position) {
+    T value;
+    std::memcpy(&value, position, sizeof(T));
+    return value;
+}
+
+static std::uint64_t computeChecksum(std::span<const std::byte> payload) {
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (std::size_t i = 0; i + sizeof(std::uint64_t) <= payload.size();
+         i += sizeof(std::uint64_t)) {
+        hash ^= readValue<std::uint64_t>(payload.data() + i);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+class SnapshotBuffer {
+   public:
+    template <typename T>
+    void append(T value) {
+        std::size_t position = bytes.size();
+        bytes.resize(position + sizeof(T));
+        std::memcpy(bytes.data() + position, &value, sizeof(T));
+    }
+
+    template <typename T>
+    void writeAt(std::size_t position, T value) {
+        std::memcpy(bytes.data() + position, &value, sizeof(T));
+    }
+
+    void appendBytes(const std::string& text) {
+        std::size_t position = bytes.size();
+        bytes.resize(position + text.size());
+        std::memcpy(bytes.data() + position, text.data(), text.size());
+    }
+
+    void align() { bytes.resize(alignedSize(bytes.size())); }
+    void reserve(std::size_t capacity) { bytes.reserve(capacity); }
+
+    std::size_t size() const { return bytes.size(); }
+    std::span<const std::byte> view() const { return bytes; }
+    std::vector<std::byte> release() { return std::move(bytes); }
+
+   private:
+    std::vector<std::byte> bytes;
+};
+
+class StringTable {
+   public:
+    std::uint32_t intern(const QString& text) {
+        auto [it, inserted] = ids.try_emplace(
+            text.toStdString(), static_cast<std::uint32_t>(strings.size()));
+        if (inserted) {
+            strings.push_back(&it->first);
+        }
+        return it->second;
+    }
+
+    std::size_t size() const { return strings.size(); }
+
+    void write(SnapshotBuffer& buffer) const {
+        std::uint64_t offset = 0;
+        buffer.append<std::uint32_t>(0);
+        for (const std::string* text : strings) {
+            offset += text->size();
+            if (offset > UINT32_MAX) {
+                throw FileManagerException("Snapshot string table too large");
+            }
+            buffer.append(static_cast<std::uint32_t>(offset));
+        }
+        buffer.align();
+        for (const std::string* text : strings) {
+            buffer.appendBytes(*text);
+        }
+        buffer.align();
+    }
+
+   private:
+    std::unordered_map<std::string, std::uint32_t> ids;
+    std::vector<const std::string*> strings;
+};
+
+template <typename T, typename Rows, typename Fn>
+static void appendColumn(SnapshotBuffer& buffer, const Rows& rows,
+                         Fn&& valueOf) {
+    for (const auto& row : rows) {
+        buffer.append(static_cast<T>(valueOf(row)));
+    }
+    buffer.align();
+}
+
+static EmployeeDetails getEmployeeDetails(const Employee& employee) {
+    if (const auto* manager = dynamic_cast<const Manager*>(&employee)) {
+        return {{}, manager->getManagedProjectId(), 0.0};
+    }
+    if (const auto* developer = dynamic_cast<const Developer*>(&employee)) {
+        return {developer->getProgrammingLanguage(), 0,
+                developer->getYearsOfExperience()};
+    }
+    if (const auto* designer = dynamic_cast<const Designer*>(&employee)) {
+        return {designer->getDesignTool(), designer->getNumberOfProjects(),
+                0.0};
+    }
+    if (const auto* qaEmployee = dynamic_cast<const QA*>(&employee)) {
+        return {qaEmployee->getTestingType(), qaEmployee->getBugsFound(), 0.0};
+    }
+    return {};
+}
+
+static std::uint32_t writeCompanySection(SnapshotBuffer& buffer,
+                                         StringTable& strings,
+                                         const Company& company) {
+    std::array<const Company*, 1> rows{&company};
+    appendColumn<std::uint32_t>(buffer, rows, [&](const Company* c) {
+        return strings.intern(c->getName());
+    });
+    appendColumn<std::uint32_t>(buffer, rows, [&](const Company* c) {
+        return strings.intern(c->getIndustry());
+    });
+    appendColumn<std::uint32_t>(buffer, rows, [&](const Company* c) {
+        return strings.intern(c->getLocation());
+    });
+    appendColumn<std::int32_t>(
+        buffer, rows, [](const Company* c) { return c->getFoundedYear(); });
+    return static_cast<std::uint32_t>(rows.size());
+}
+
+static std::uint32_t writeEmployeesSection(SnapshotBuffer& buffer,
+                                           StringTable& strings,
+                                           const Company& company) {
+    std::vector<const Employee*> employees;
+    std::vector<EmployeeDetails> details;
+    for (const auto& employee : company.getEmployeesView()) {
+        if (!employee || employee->getTypeCode() == EmployeeType::Unknown) {
+            continue;
+        }
+        employees.push_back(employee.get());
+        details.push_back(getEmployeeDetails(*employee));
+    }
+
+    appendColumn<std::int32_t>(buffer, employees,
+                               [](const Employee* e) { return e->getId(); });
+    appendColumn<std::uint8_t>(
+        buffer, employees, [](const Employee* e) { return e->getTypeCode(); });
+    appendColumn<std::uint8_t>(
+        buffer, employees, [](const Employee* e) { return e->getIsActive(); });
+    appendColumn<std::uint32_t>(buffer, employees, [&](const Employee* e) {
+        return strings.intern(e->getName());
+    });
+    appendColumn<std::uint32_t>(buffer, employees, [&](const Employee* e) {
+        return strings.intern(e->getDepartment());
+    });
+    appendColumn<double>(buffer, employees,
+                         [](const Employee* e) { return e->getSalary(); });
+    appendColumn<double>(buffer, employees, [](const Employee* e) {
+        return e->getEmploymentRate();
+    });
+    appendColumn<std::uint32_t>(buffer, details, [&](const auto& detail) {
+        return strings.intern(detail.text);
+    });
+    appendColumn<std::int32_t>(
+        buffer, details, [](const auto& detail) { return detail.number; });
+    appendColumn<double>(buffer, details,
+                         [](const auto& detail) { return detail.real; });
+    return static_cast<std::uint32_t>(employees.size());
+}
+
+static std::uint32_t writeProjectsSection(SnapshotBuffer& buffer,
+                                          StringTable& strings,
+                                          const Company& company) {
+    auto projects = company.getProjectsView();
+
+    appendColumn<std::int32_t>(buffer, projects,
+                               [](const Project& p) { return p.getId(); });
+    appendColumn<std::uint32_t>(buffer, projects, [&](const Project& p) {
+        return strings.intern(p.getName());
+    });
+    appendColumn<std::uint32_t>(buffer, projects, [&](const Project& p) {
+        return strings.intern(p.getDescription());
+    });
+    appendColumn<std::uint32_t>(buffer, projects, [&](const Project& p) {
+        return strings.intern(p.getPhase());
+    });
+    appendColumn<std::int64_t>(buffer, projects, [](const Project& p) {
+        return p.getStartDate().toJulianDay();
+    });
+    appendColumn<std::int64_t>(buffer, projects, [](const Project& p) {
+        return p.getEndDate().toJulianDay();
+    });
+    appendColumn<double>(buffer, projects,
+                         [](const Project& p) { return p.getBudget(); });
+    appendColumn<std::uint32_t>(buffer, projects, [&](const Project& p) {
+        return strings.intern(p.getClientName());
+    });
+    appendColumn<std::int32_t>(buffer, projects, [](const Project& p) {
+        return p.getInitialEstimatedHours();
+    });
+    return static_cast<std::uint32_t>(std::ranges::distance(projects));
+}
+
+static std::uint32_t writeTasksSection(SnapshotBuffer& buffer,
+                                       StringTable& strings,
+                                       const Company& company) {
+    struct TaskRow {
+        int projectId;
+        const Task* task;
+    };
+    std::vector<TaskRow> tasks;
+    for (const auto& project : company.getProjectsView()) {
+        for (const auto& task : project.getTasks()) {
+            tasks.push_back({project.getId(), &task});
+        }
+    }
+
+    appendColumn<std::int32_t>(
+        buffer, tasks, [](const TaskRow& row) { return row.projectId; });
+    appendColumn<std::int32_t>(
+        buffer, tasks, [](const TaskRow& row) { return row.task->getId(); });
+    appendColumn<std::uint32_t>(buffer, tasks, [&](const TaskRow& row) {
+        return strings.intern(row.task->getName());
+    });
+    appendColumn<std::uint32_t>(buffer, tasks, [&](const TaskRow& row) {
+        return strings.intern(row.task->getType());
+    });
+    appendColumn<std::int32_t>(buffer, tasks, [](const TaskRow& row) {
+        return row.task->getEstimatedHours();
+    });
+    appendColumn<std::int32_t>(buffer, tasks, [](const TaskRow& row) {
+        return row.task->getAllocatedHours();
+    });
+    appendColumn<std::int32_t>(buffer, tasks, [](const TaskRow& row) {
+        return row.task->getPriority();
+    });
+    appendColumn<std::uint32_t>(buffer, tasks, [&](const TaskRow& row) {
+        return strings.intern(row.task->getPhase());
+    });
+    return static_cast<std::uint32_t>(tasks.size());
+}
+
+static std::uint32_t writeAssignmentsSection(SnapshotBuffer& buffer,
+                                             const Company& company) {
+    std::vector<std::array<int, 4>> assignments;
+    assignments.reserve(company.getAssignmentStore().size());
+    company.getAssignmentStore().forEach(
+        [&assignments](int employeeId, int projectId, int taskId, int hours) {
+            assignments.push_back({employeeId, projectId, taskId, hours});
+        });
+
+    for (std::size_t column = 0; column < 4; ++column) {
+        appendColumn<std::int32_t>(
+            buffer, assignments,
+            [column](const auto& assignment) { return assignment[column]; });
+    }
+    return static_cast<std::uint32_t>(assignments.size());
+}
+
+static SnapshotBuffer buildSnapshot(const Company& company) {
+    SnapshotBuffer buffer;
+    buffer.reserve(kHeaderSize + kSnapshotSectionCount * kSectionEntrySize +
+                   company.getAssignmentStore().size() * 4 *
+                       sizeof(std::int32_t));
+
+    for (char c : kSnapshotMagic) {
+        buffer.append(c);
+    }
+    buffer.append(CompanySnapshot::kFormatVersion);
+    buffer.append(kByteOrderMark);
+    buffer.append(static_cast<std::uint32_t>(kSnapshotSectionCount));
+    buffer.append<std::uint32_t>(0);
+    buffer.append<std::uint64_t>(0);
+    buffer.append<std::uint64_t>(0);
+
+    std::size_t directoryStart = buffer.size();
+    for (std::size_t i = 0; i < kSnapshotSectionCount; ++i) {
+        buffer.append(static_cast<std::uint32_t>(i));
+        buffer.append<std::uint32_t>(0);
+        buffer.append<std::uint64_t>(0);
+        buffer.append<std::uint64_t>(0);
+    }
+
+    StringTable strings;
+    auto writeSection = [&](SnapshotSection section, auto&& writeRows) {
+        std::size_t offset = buffer.size();
+        std::uint32_t rowCount = writeRows();
+        buffer.align();
+        std::size_t entry = directoryStart + static_cast<std::size_t>(section) *
+                                                 kSectionEntrySize;
+        buffer.writeAt(entry + 4, rowCount);
+        buffer.writeAt<std::uint64_t>(entry + 8, offset);
+        buffer.writeAt<std::uint64_t>(entry + 16, buffer.size() - offset);
+    };
+
+    writeSection(SnapshotSection::Company, [&] {
+        return writeCompanySection(buffer, strings, company);
+    });
+    writeSection(SnapshotSection::Employees, [&] {
+        return writeEmployeesSection(buffer, strings, company);
+    });
+    writeSection(SnapshotSection::Projects, [&] {
+        return writeProjectsSection(buffer, strings, company);
+    });
+    writeSection(SnapshotSection::Tasks, [&] {
+        return writeTasksSection(buffer, strings, company);
+    });
+    writeSection(SnapshotSection::Assignments,
+                 [&] { return writeAssignmentsSection(buffer, company); });
+    writeSection(SnapshotSection::Strings, [&] {
+        strings.write(buffer);
+        return static_cast<std::uint32_t>(strings.size());
+    });
+
+    auto payload = buffer.view().subspan(kHeaderSize);
+    buffer.writeAt<std::uint64_t>(kPayloadSizeOffset, payload.size());
+    buffer.writeAt<std::uint64_t>(kChecksumOffset, computeChecksum(payload));
+    return buffer;
+}
+
+template <typename T>
+class Column {
+   public:
+    explicit Column(const std::byte* columnData) : data(columnData) {}
+
+    T operator[](std::size_t row) const {
+        return readValue<T>(data + row * sizeof(T));
+    }
+
+   private:
+    const std::byte* data;
+};
+
+class SectionReader {
+   public:
+    SectionReader(std::span<const std::byte> sectionBytes,
+                  std::size_t sectionRows)
+        : bytes(sectionBytes), rows(sectionRows) {}
+
+    template <typename T>
+    Column<T> next() {
+        return Column<T>(take(rows * sizeof(T)).data());
+    }
+
+    std::span<const std::byte> take(std::size_t size) {
+        std::size_t padded = alignedSize(size);
+        if (padded > bytes.size() - position) {
+            throw FileManagerException("Snapshot section is truncated");
+        }
+        auto taken = bytes.subspan(position, size);
+        position += padded;
+        return taken;
+    }
+
+    std::span<const std::byte> rest() const { return bytes.subspan(position); }
+    std::size_t rowCount() const { return rows; }
+
+   private:
+    std::span<const std::byte> bytes;
+    std::size_t rows;
+    std::size_t position = 0;
+};
+
+class StringTableReader {
+   public:
+    explicit StringTableReader(SectionReader section)
+        : count(section.rowCount()),
+          offsets(section.take((count + 1) * sizeof(std::uint32_t)).data()),
+          text(section.rest()) {
+        if (offsets[count] > text.size()) {
+            throw FileManagerException("Snapshot string table is truncated");
+        }
+    }
+
+    QString at(std::uint32_t id) const {
+        if (id >= count) {
+            throw FileManagerException("Snapshot string index out of range");
+        }
+        std::uint32_t begin = offsets[id];
+        std::uint32_t end = offsets[id + 1];
+        if (begin > end || end > text.size()) {
+            throw FileManagerException("Snapshot string table is corrupt");
+        }
+        return QString::fromUtf8(reinterpret_cast<const char*>(text.data()) +
+                                     begin,
+                                 static_cast<qsizetype>(end - begin));
+    }
+
+   private:
+    std::size_t count;
+    Column<std::uint32_t> offsets;
+    std::span<const std::byte> text;
+};
+
+static std::span<const std::byte> mapSnapshot(QFile& file,
+                                              QByteArray& fallback) {
+    auto fileSize = file.size();
+    if (fileSize <= 0) {
+        return {};
+    }
+    if (const uchar* mapped = file.map(0, fileSize)) {
+        return {reinterpret_cast<const std::byte*>(mapped),
+                static_cast<std::size_t>(fileSize)};
+    }
+
+    fallback = file.readAll();
+    return {reinterpret_cast<const std::byte*>(fallback.constData()),
+            static_cast<std::size_t>(fallback.size())};
+}
+
+static SectionDirectory readSectionDirectory(std::span<const std::byte> bytes,
+                                             const QString& fileName) {
+    if (bytes.size() < kHeaderSize ||
+        std::memcmp(bytes.data(), kSnapshotMagic.data(),
+                    kSnapshotMagic.size()) != 0) {
+        throw FileManagerException("Not a company snapshot: " + fileName);
+    }
+    if (auto version = readValue<std::uint32_t>(bytes.data() + 8);
+        version != CompanySnapshot::kFormatVersion) {
+        throw FileManagerException(
+            QString("Unsupported snapshot version %1: %2")
+                .arg(version)
+                .arg(fileName));
+    }
+    if (readValue<std::uint32_t>(bytes.data() + 12) != kByteOrderMark ||
+        readValue<std::uint32_t>(bytes.data() + 16) != kSnapshotSectionCount) {
+        throw FileManagerException("Incompatible snapshot layout: " +
+                                   fileName);
+    }
+
+    auto payload = bytes.subspan(kHeaderSize);
+    if (readValue<std::uint64_t>(bytes.data() + kPayloadSizeOffset) !=
+            payload.size() ||
+        payload.size() % kAlignment != 0 ||
+        payload.size() < kSnapshotSectionCount * kSectionEntrySize) {
+        throw FileManagerException("Snapshot is truncated: " + fileName);
+    }
+
+    SectionDirectory directory;
+    for (std::size_t i = 0; i < kSnapshotSectionCount; ++i) {
+        const std::byte* entry = payload.data() + i * kSectionEntrySize;
+        SectionEntry& section = directory[i];
+        section.rowCount = readValue<std::uint32_t>(entry + 4);
+        section.offset = readValue<std::uint64_t>(entry + 8);
+        section.size = readValue<std::uint64_t>(entry + 16);
+        if (readValue<std::uint32_t>(entry) != i ||
+            section.offset % kAlignment != 0 || section.offset > bytes.size() ||
+            section.size > bytes.size() - section.offset) {
+            throw FileManagerException("Snapshot directory is corrupt: " +
+                                       fileName);
+        }
+    }
+    return directory;
+}
+
+static void verifyChecksum(std::span<const std::byte> bytes,
+                           const QString& fileName) {
+    if (readValue<std::uint64_t>(bytes.data() + kChecksumOffset) !=
+        computeChecksum(bytes.subspan(kHeaderSize))) {
+        throw FileManagerException("Snapshot checksum mismatch: " + fileName);
+    }
+}
+
+static SectionReader openSection(std::span<const std::byte> bytes,
+                                 const SectionDirectory& directory,
+                                 SnapshotSection section) {
+    const SectionEntry& entry = directory[static_cast<std::size_t>(section)];
+    return {bytes.subspan(entry.offset, entry.size), entry.rowCount};
+}
+
+static Company readCompany(SectionReader section,
+                           const StringTableReader& strings) {
+    if (section.rowCount() != 1) {
+        throw FileManagerException("Snapshot has no company record");
+    }
+    auto name = section.next<std::uint32_t>();
+    auto industry = section.next<std::uint32_t>();
+    auto location = section.next<std::uint32_t>();
+    auto foundedYear = section.next<std::int32_t>();
+    return {strings.at(name[0]), strings.at(industry[0]),
+            strings.at(location[0]), foundedYear[0]};
+}
+
+static void readEmployees(Company& company, SectionReader section,
+                          const StringTableReader& strings) {
+    auto ids = section.next<std::int32_t>();
+    auto types = section.next<std::uint8_t>();
+    auto active = section.next<std::uint8_t>();
+    auto names = section.next<std::uint32_t>();
+    auto departments = section.next<std::uint32_t>();
+    auto salaries = section.next<double>();
+    auto rates = section.next<double>();
+    auto detailTexts = section.next<std::uint32_t>();
+    auto detailNumbers = section.next<std::int32_t>();
+    auto detailReals = section.next<double>();
+
+    for (std::size_t row = 0; row < section.rowCount(); ++row) {
+        int id = ids[row];
+        QString name = strings.at(names[row]);
+        QString department = strings.at(departments[row]);
+
+        std::shared_ptr<Employee> employee;
+        switch (static_cast<EmployeeType>(types[row])) {
+            case EmployeeType::Manager:
+                employee = std::make_shared<Manager>(
+                    id, name, salaries[row], department, detailNumbers[row],
+                    rates[row]);
+                break;
+            case EmployeeType::Developer:
+                employee = std::make_shared<Developer>(
+                    id, name, salaries[row], department,
+                    strings.at(detailTexts[row]), detailReals[row],
+                    rates[row]);
+                break;
+            case EmployeeType::Designer:
+                employee = std::make_shared<Designer>(
+                    id, name, salaries[row], department,
+                    strings.at(detailTexts[row]), detailNumbers[row],
+                    rates[row]);
+                break;
+            case EmployeeType::QA:
+                employee = std::make_shared<QA>(
+                    id, name, salaries[row], department,
+                    strings.at(detailTexts[row]), detailNumbers[row],
+                    rates[row]);
+                break;
+            case EmployeeType::Unknown:
+                break;
+        }
+
+        if (employee) {
+            employee->setIsActive(active[row] != 0);
+            company.addEmployee(employee);
+        }
+    }
+}
+
+static void readProjects(Company& company, SectionReader section,
+                         const StringTableReader& strings) {
+    auto ids = section.next<std::int32_t>();
+    auto names = section.next<std::uint32_t>();
+    auto descriptions = section.next<std::uint32_t>();
+    auto phases = section.next<std::uint32_t>();
+    auto startDays = section.next<std::int64_t>();
+    auto endDays = section.next<std::int64_t>();
+    auto budgets = section.next<double>();
+    auto clients = section.next<std::uint32_t>();
+    auto estimatedHours = section.next<std::int32_t>();
+
+    for (std::size_t row = 0; row < section.rowCount(); ++row) {
+        QString name = strings.at(names[row]);
+        QString description = strings.at(descriptions[row]);
+        QString phase = strings.at(phases[row]);
+        QDate startDate = QDate::fromJulianDay(startDays[row]);
+        QDate endDate = QDate::fromJulianDay(endDays[row]);
+        QString clientName = strings.at(clients[row]);
+
+        ProjectParams projectParams{
+            ids[row],      name,      description, phase, startDate, endDate,
+            budgets[row], clientName, estimatedHours[row]};
+        company.addProject(Project(projectParams));
+    }
+}
+
+static void readTasks(Company& company, SectionReader section,
+                      const StringTableReader& strings) {
+    auto projectIds = section.next<std::int32_t>();
+    auto ids = section.next<std::int32_t>();
+    auto names = section.next<std::uint32_t>();
+    auto types = section.next<std::uint32_t>();
+    auto estimatedHours = section.next<std::int32_t>();
+    auto allocatedHours = section.next<std::int32_t>();
+    auto priorities = section.next<std::int32_t>();
+    auto phases = section.next<std::uint32_t>();
+
+    Project* project = nullptr;
+    for (std::size_t row = 0; row < section.rowCount(); ++row) {
+        if (!project || project->getId() != projectIds[row]) {
+            if (project) project->recomputeTotalsFromTasks();
+            project = company.getProject(projectIds[row]);
+            if (!project) continue;
+        }
+
+        Task task(ids[row], strings.at(names[row]), strings.at(types[row]),
+                  estimatedHours[row], priorities[row]);
+        task.setPhase(strings.at(phases[row]));
+        task.setAllocatedHours(allocatedHours[row]);
+        project->getTasks().push_back(task);
+    }
+    if (project) project->recomputeTotalsFromTasks();
+}
+
+static void readAssignments(Company& company, SectionReader section) {
+    auto employeeIds = section.next<std::int32_t>();
+    auto projectIds = section.next<std::int32_t>();
+    auto taskIds = section.next<std::int32_t>();
+    auto hours = section.next<std::int32_t>();
+
+    auto& taskManager = company.getTaskManager();
+    for (std::size_t row = 0; row < section.rowCount(); ++row) {
+        std::shared_ptr<Employee> employee =
+            company.getEmployee(employeeIds[row]);
+        if (!employee || !company.getProject(projectIds[row])) continue;
+
+        taskManager.setTaskAssignment(employeeIds[row], projectIds[row],
+                                      taskIds[row], hours[row]);
+        employee->addToProjectHistory(projectIds[row]);
+        if (employee->getIsActive()) {
+            employee->addAssignedProject(projectIds[row]);
+        }
+    }
+}
+
+std::vector<std::byte> CompanySnapshot::encode(const Company& company) {
+    return buildSnapshot(company).release();
+}
+
+std::uint64_t CompanySnapshot::write(std::span<const std::byte> image,
+                                     const QString& fileName) {
+    if (image.size() < kHeaderSize) {
+        throw FileManagerException("Snapshot image is incomplete: " + fileName);
+    }
+
+    // QSaveFile syncs the image to disk and renames it over the old snapshot
+    // in one step, so a crash leaves either the old or the new file in place.
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        throw FileManagerException("Cannot open file for writing: " +
+                                   fileName);
+    }
+
+    auto written = file.write(reinterpret_cast<const char*>(image.data()),
+                              static_cast<qint64>(image.size()));
+    if (written != static_cast<qint64>(image.size())) {
+        file.cancelWriting();
+        throw FileManagerException("Error writing snapshot to file: " +
+                                   fileName);
+    }
+    if (!file.commit()) {
+        throw FileManagerException("Error replacing file: " + fileName);
+    }
+    return readValue<std::uint64_t>(image.data() + kChecksumOffset);
+}
+
+std::uint64_t CompanySnapshot::save(const Company& company,
+                                    const QString& fileName) {
+    return write(encode(company), fileName);
+}
+
+Company CompanySnapshot::load(const QString& fileName) {
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        throw FileManagerException("Cannot open file for reading: " + fileName);
+    }
+
+    QByteArray fallback;
+    std::span<const std::byte> bytes = mapSnapshot(file, fallback);
+    SectionDirectory directory = readSectionDirectory(bytes, fileName);
+    verifyChecksum(bytes, fileName);
+
+    try {
+        StringTableReader strings(
+            openSection(bytes, directory, SnapshotSection::Strings));
+        Company company = readCompany(
+            openSection(bytes, directory, SnapshotSection::Company), strings);
+        {
+            // Closed before the company is moved out.
+            TaskAssignmentManager::BulkLoad bulkLoad(company.getTaskManager());
+            readEmployees(
+                company,
+                openSection(bytes, directory, SnapshotSection::Employees),
+                strings);
+            readProjects(
+                company,
+                openSection(bytes, directory, SnapshotSection::Projects),
+                strings);
+            readTasks(company,
+                      openSection(bytes, directory, SnapshotSection::Tasks),
+                      strings);
+            readAssignments(
+                company,
+                openSection(bytes, directory, SnapshotSection::Assignments));
+        }
+        return company;
+    } catch (const FileManagerException&) {
+        throw;
+    } catch (const BaseException& e) {
+        throw FileManagerException("Invalid snapshot data in " + fileName +
+                                   ": " + e.getMessage());
+    }
+}
+
+Company CompanySnapshot::loadHeader(const QString& fileName) {
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        throw FileManagerException("Cannot open file for reading: " + fileName);
+    }
+
+    QByteArray fallback;
+    std::span<const std::byte> bytes = mapSnapshot(file, fallback);
+    SectionDirectory directory = readSectionDirectory(bytes, fileName);
+
+    try {
+        StringTableReader strings(
+            openSection(bytes, directory, SnapshotSection::Strings));
+        return readCompany(
+            openSection(bytes, directory, SnapshotSection::Company), strings);
+    } catch (const FileManagerException&) {
+        throw;
+    } catch (const BaseException& e) {
+        throw FileManagerException("Invalid snapshot data in " + fileName +
+                                   ": " + e.getMessage());
+    }
+}
+
+std::uint64_t CompanySnapshot::readChecksum(const QString& fileName) {
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        throw FileManagerException("Cannot open file for reading: " + fileName);
+    }
+
+    QByteArray header = file.read(kHeaderSize);
+    if (static_cast<std::size_t>(header.size()) < kHeaderSize ||
+        std::memcmp(header.constData(), kSnapshotMagic.data(),
+                    kSnapshotMagic.size()) != 0) {
+        throw FileManagerException("Not a company snapshot: " + fileName);
+    }
+    return readValue<std::uint64_t>(
+        reinterpret_cast<const std::byte*>(header.constData()) +
+        kChecksumOffset);
+}
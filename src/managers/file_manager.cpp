@@ -2,6 +2,7 @@
 
 #include <QDate>
 #include <QFile>
+#include <charconv>
 #include <format>
 #include <fstream>
 #include <iomanip>
@@ -10,25 +11,15 @@
 #include <set>
 #include <sstream>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "entities/derived_employees.h"
 #include "utils/consts.h"
 
-std::map<int, bool> FileManager::employeeStatusesFromFile;
-
-struct TaskFieldData {
-    int projectId = 0;
-    int taskId = 0;
-    QString taskName;
-    QString taskType;
-    int estimatedHours = 0;
-    int allocatedHours = 0;
-    int priority = 0;
-    QString phase;
-};
-
 struct TaskData {
     int projectId = 0;
     int taskId = 0;
@@ -41,82 +32,60 @@ struct TaskData {
     std::vector<std::pair<int, int>> assignments;
 };
 
-struct ProcessTaskParams {
-    const std::vector<std::string>& lines;
-    int& lineIndex;
-    int taskIndex;
-    int taskCount;
-    TaskData& taskData;
+struct AssignmentReadState {
+    int count = 0;
+    int read = 0;
+    bool reading = false;
 };
 
-static void updateTaskDataFromField(TaskData& taskData,
-                                    const TaskFieldData& fieldData) {
-    if (fieldData.projectId > 0) {
-        taskData.projectId = fieldData.projectId;
-    }
-    if (fieldData.taskId > 0) {
-        taskData.taskId = fieldData.taskId;
-    }
-    if (!fieldData.taskName.isEmpty()) {
-        taskData.taskName = fieldData.taskName;
-    }
-    if (!fieldData.taskType.isEmpty()) {
-        taskData.taskType = fieldData.taskType;
-    }
-    if (fieldData.estimatedHours >= 0) {
-        taskData.estimatedHours = fieldData.estimatedHours;
-    }
-    if (fieldData.allocatedHours >= 0) {
-        taskData.allocatedHours = fieldData.allocatedHours;
-    }
-    if (fieldData.priority >= 0) {
-        taskData.priority = fieldData.priority;
-    }
-    if (!fieldData.phase.isEmpty()) {
-        taskData.phase = fieldData.phase;
-    }
+// Read position over a tasks file that stays mapped for the whole load, so
+// lines are views into it rather than copies.
+struct TextCursor {
+    std::string_view text;
+    size_t position = 0;
+};
+
+static bool parseInt(std::string_view text, int& value) {
+    auto [end, error] =
+        std::from_chars(text.data(), text.data() + text.size(), value);
+    return error == std::errc{};
 }
 
-static void parseTaskField(std::string_view lineContent, TaskFieldData& data) {
-    if (lineContent.find("PROJECT_ID:") == 0) {
-        std::string subStr(lineContent.substr(11));
-        data.projectId = std::stoi(subStr);
-    } else if (lineContent.find("TASK_ID:") == 0) {
-        std::string subStr(lineContent.substr(8));
-        data.taskId = std::stoi(subStr);
-    } else if (lineContent.find("NAME:") == 0) {
-        data.taskName =
-            QString::fromStdString(std::string(lineContent.substr(5)));
-    } else if (lineContent.find("TYPE:") == 0) {
-        data.taskType =
-            QString::fromStdString(std::string(lineContent.substr(5)));
-    } else if (lineContent.find("ESTIMATED_HOURS:") == 0) {
-        std::string subStr(lineContent.substr(16));
-        data.estimatedHours = std::stoi(subStr);
-    } else if (lineContent.find("ALLOCATED_HOURS:") == 0) {
-        std::string subStr(lineContent.substr(16));
-        data.allocatedHours = std::stoi(subStr);
-    } else if (lineContent.find("PRIORITY:") == 0) {
-        std::string subStr(lineContent.substr(9));
-        data.priority = std::stoi(subStr);
-    } else if (lineContent.find("PHASE:") == 0) {
-        data.phase = QString::fromStdString(std::string(lineContent.substr(6)));
+static QString toQString(std::string_view text) {
+    return QString::fromUtf8(text.data(), static_cast<qsizetype>(text.size()));
+}
+
+static void parseTaskField(std::string_view lineContent, TaskData& data) {
+    if (lineContent.starts_with("PROJECT_ID:")) {
+        parseInt(lineContent.substr(11), data.projectId);
+    } else if (lineContent.starts_with("TASK_ID:")) {
+        parseInt(lineContent.substr(8), data.taskId);
+    } else if (lineContent.starts_with("NAME:")) {
+        data.taskName = toQString(lineContent.substr(5));
+    } else if (lineContent.starts_with("TYPE:")) {
+        data.taskType = toQString(lineContent.substr(5));
+    } else if (lineContent.starts_with("ESTIMATED_HOURS:")) {
+        parseInt(lineContent.substr(16), data.estimatedHours);
+    } else if (lineContent.starts_with("ALLOCATED_HOURS:")) {
+        parseInt(lineContent.substr(16), data.allocatedHours);
+    } else if (lineContent.starts_with("PRIORITY:")) {
+        parseInt(lineContent.substr(9), data.priority);
+    } else if (lineContent.starts_with("PHASE:")) {
+        data.phase = toQString(lineContent.substr(6));
     }
 }
 
 static void parseAssignmentLine(std::string_view lineContent,
                                 std::vector<std::pair<int, int>>& assignments,
-                                int& assignmentsRead, int assignmentsCount,
-                                bool& readingAssignments) {
-    if (assignmentsRead >= assignmentsCount ||
+                                AssignmentReadState& state) {
+    if (state.read >= state.count ||
         assignments.size() >= static_cast<size_t>(kMaxSmallAssignments)) {
-        readingAssignments = false;
+        state.reading = false;
         return;
     }
 
     size_t empPos = lineContent.find("EMPLOYEE_ID:");
     size_t hoursPos = lineContent.find("HOURS:");
-
     if (empPos == std::string_view::npos ||
         hoursPos == std::string_view::npos) {
         return;
@@ -124,94 +93,53 @@ static void parseAssignmentLine(std::string_view lineContent,
 
     int employeeId = 0;
     int hours = 0;
-    try {
-        std::string empStr(lineContent.substr(empPos + 12));
-        std::string hoursStr(lineContent.substr(hoursPos + 6));
-        employeeId = std::stoi(empStr);
-        hours = std::stoi(hoursStr);
-    } catch (const std::invalid_argument&) {
-        return;
-    } catch (const std::out_of_range&) {
+    if (!parseInt(lineContent.substr(empPos + 12), employeeId) ||
+        !parseInt(lineContent.substr(hoursPos + 6), hours)) {
         return;
     }
 
     if (employeeId > 0 && hours > 0) {
         assignments.emplace_back(employeeId, hours);
-        assignmentsRead++;
-        if (assignmentsRead >= assignmentsCount) {
-            readingAssignments = false;
+        state.read++;
+        if (state.read >= state.count) {
+            state.reading = false;
         }
     }
 }
 
-static void collectTaskAssignments(
-    const Company& company, int projectId, int taskId,
-    const std::vector<std::shared_ptr<Employee>>& employees,
-    std::vector<std::pair<int, int>>& assignments) {
-    if (assignments.size() >= static_cast<size_t>(kMaxSmallAssignments)) {
-        return;
-    }
-
-    for (const auto& emp : employees) {
-        if (!emp) continue;
-
-        if (assignments.size() >= static_cast<size_t>(kMaxSmallAssignments)) {
-            break;
-        }
-
-        auto taskHours =
-            company.getEmployeeHours(emp->getId(), projectId, taskId);
-
-        if (taskHours <= 0) {
-            continue;
-        }
-
-        assignments.push_back(std::make_pair(emp->getId(), taskHours));
-    }
+static std::unordered_map<int, std::vector<std::pair<int, int>>>
+groupProjectAssignmentsByTask(const Company& company, int projectId) {
+    std::unordered_map<int, std::vector<std::pair<int, int>>> assignmentsByTask;
+    company.getAssignmentStore().forEachOfProject(
+        projectId, [&assignmentsByTask](int employeeId, int taskId, int hours) {
+            if (hours <= 0) return;
+            auto& assignments = assignmentsByTask[taskId];
+            if (assignments.size() <
+                static_cast<size_t>(kMaxSmallAssignments)) {
+                assignments.emplace_back(employeeId, hours);
+            }
+        });
+    return assignmentsByTask;
 }
 
 static void processTaskAssignmentLine(
-    const std::string& lineContent,
-    std::vector<std::pair<int, int>>& assignments, int& assignmentsRead,
-    int& assignmentsCount, bool& readingAssignments) {
-    if (lineContent.find("ASSIGNMENTS_COUNT:") == 0) {
-        try {
-            int parsedCount = std::stoi(lineContent.substr(18));
-            if (parsedCount >= 0 && parsedCount <= kMaxSmallAssignments) {
-                assignmentsCount = parsedCount;
-                readingAssignments = assignmentsCount > 0;
-                assignmentsRead = 0;
-            } else {
-                assignmentsCount = 0;
-                readingAssignments = false;
-            }
-        } catch (const std::invalid_argument&) {
-            assignmentsCount = 0;
-        } catch (const std::out_of_range&) {
-            assignmentsCount = 0;
+    std::string_view lineContent,
+    std::vector<std::pair<int, int>>& assignments, AssignmentReadState& state) {
+    if (lineContent.starts_with("ASSIGNMENTS_COUNT:")) {
+        int parsedCount = 0;
+        if (parseInt(lineContent.substr(18), parsedCount) &&
+            parsedCount >= 0 && parsedCount <= kMaxSmallAssignments) {
+            state.count = parsedCount;
+            state.reading = state.count > 0;
+            state.read = 0;
+        } else {
+            state.count = 0;
+            state.reading = false;
         }
     }
 
-    if (readingAssignments && lineContent.find("  [") == 0) {
-        parseAssignmentLine(lineContent, assignments, assignmentsRead,
-                            assignmentsCount, readingAssignments);
-    }
-}
-
-static void processTaskAssignments(
-    Company& company, int projectId, int taskId,
-    const std::vector<std::pair<int, int>>& assignments) {
-    for (const auto& assignment : assignments) {
-        const auto& [empId, hours] = assignment;
-        try {
-            company.assignEmployeeToTask(empId, projectId, taskId, hours);
-        } catch (const CompanyException&) {
-            try {
-                company.restoreTaskAssignment(empId, projectId, taskId, hours);
-            } catch (const CompanyException&) {
-                continue;
-            }
-        }
+    if (state.reading && lineContent.starts_with("  [")) {
+        parseAssignmentLine(lineContent, assignments, state);
     }
 }
 
@@ -233,115 +161,107 @@ static void addTaskToCompany(Company& company, const AddTaskParams& params) {
     task.setPhase(params.phase);
     task.setAllocatedHours(params.allocatedHours);
     company.addTaskToProject(params.projectId, task);
-    processTaskAssignments(company, params.projectId, params.taskId,
-                           params.assignments);
+    company.restoreTaskAssignments(params.projectId, params.taskId,
+                                   params.assignments);
 }
 
-static std::vector<std::string> readFileLines(const QString& fileName) {
-    std::ifstream fileStream(fileName.toStdString());
-    if (!fileStream.is_open()) {
-        throw FileManagerException("Cannot open file for reading: " + fileName);
+static std::string_view mapFileContents(QFile& file, QByteArray& fallback) {
+    auto fileSize = file.size();
+    if (fileSize > kMaxFileSizeBytes) {
+        throw FileManagerException("File too large: " + file.fileName());
     }
-
-    fileStream.seekg(0, std::ios::end);
-    std::streampos fileSize = fileStream.tellg();
     if (fileSize == 0) {
-        fileStream.close();
         return {};
     }
 
-    if (const auto maxFileSize = std::streampos(kMaxFileSizeBytes);
-        fileSize > maxFileSize) {
-        fileStream.close();
-        throw FileManagerException("File too large: " + fileName);
+    if (const uchar* mapped = file.map(0, fileSize)) {
+        return {reinterpret_cast<const char*>(mapped),
+                static_cast<size_t>(fileSize)};
     }
 
-    fileStream.seekg(0, std::ios::beg);
+    fallback = file.readAll();
+    return {fallback.constData(), static_cast<size_t>(fallback.size())};
+}
 
-    std::vector<std::string> lines;
-    lines.reserve(static_cast<size_t>(kReserveCapacity));
-    std::string lineContent;
-    size_t lineCount = 0;
+static bool nextLine(TextCursor& cursor, std::string_view& line) {
+    if (cursor.position >= cursor.text.size()) {
+        return false;
+    }
 
-    while (std::getline(fileStream, lineContent) &&
-           lineCount < static_cast<size_t>(kMaxLines)) {
-        lines.push_back(lineContent);
-        lineCount++;
+    size_t lineEnd = cursor.text.find('\n', cursor.position);
+    if (lineEnd == std::string_view::npos) {
+        lineEnd = cursor.text.size();
     }
-    fileStream.close();
+    line = cursor.text.substr(cursor.position, lineEnd - cursor.position);
+    cursor.position = lineEnd + 1;
+    return true;
+}
 
-    return lines;
+static bool isAtEnd(const TextCursor& cursor) {
+    return cursor.position >= cursor.text.size();
 }
 
-static bool findTaskHeader(const std::vector<std::string>& lines,
-                           int& lastHeaderIndex, int& taskCount) {
-    for (int i = lines.size() - 1; i >= 0; --i) {
-        if (lines[i].find("TASKS_COUNT:") == 0) {
-            try {
-                int parsedCount = std::stoi(lines[i].substr(12));
-                if (parsedCount >= 0 && parsedCount <= kMaxTasks) {
-                    taskCount = parsedCount;
-                    lastHeaderIndex = i;
-                    return true;
-                }
-            } catch (const std::invalid_argument&) {
-                continue;
-            } catch (const std::out_of_range&) {
-                continue;
-            }
+static bool findTaskHeader(std::string_view text, size_t& headerPosition,
+                           int& taskCount) {
+    constexpr std::string_view kHeader = "TASKS_COUNT:";
+    size_t searchFrom = std::string_view::npos;
+    while (true) {
+        size_t position = text.rfind(kHeader, searchFrom);
+        if (position == std::string_view::npos) {
+            return false;
+        }
+
+        int parsedCount = 0;
+        if ((position == 0 || text[position - 1] == '\n') &&
+            parseInt(text.substr(position + kHeader.size()), parsedCount) &&
+            parsedCount >= 0 && parsedCount <= kMaxTasks) {
+            taskCount = parsedCount;
+            headerPosition = position;
+            return true;
         }
-    }
-    return false;
-}
 
-static int calculateStartIndex(const std::vector<std::string>& lines,
-                               int lastHeaderIndex) {
-    int startIndex = lastHeaderIndex + 2;
-    if (startIndex < static_cast<int>(lines.size()) &&
-        lines[startIndex] == "---") {
-        startIndex++;
+        if (position == 0) {
+            return false;
+        }
+        searchFrom = position - 1;
     }
-    return startIndex;
 }
 
-static bool processTask(const ProcessTaskParams& params) {
-    while (params.lineIndex < static_cast<int>(params.lines.size()) &&
-           params.lines[params.lineIndex].find("[TASK") != 0) {
-        params.lineIndex++;
-    }
+static void skipTaskHeader(TextCursor& cursor) {
+    std::string_view line;
+    nextLine(cursor, line);
+    nextLine(cursor, line);
 
-    if (params.lineIndex >= static_cast<int>(params.lines.size())) {
-        return false;
+    size_t separatorStart = cursor.position;
+    if (nextLine(cursor, line) && line != "---") {
+        cursor.position = separatorStart;
     }
+}
 
-    params.lineIndex++;
-
-    bool readingAssignments = false;
-    int assignmentsCount = 0;
-    int assignmentsRead = 0;
-
-    while (params.lineIndex < static_cast<int>(params.lines.size())) {
-        std::string lineContent = params.lines[params.lineIndex];
+static bool processTask(TextCursor& cursor, int taskIndex, int taskCount,
+                        TaskData& taskData) {
+    std::string_view lineContent;
+    do {
+        if (!nextLine(cursor, lineContent)) {
+            return false;
+        }
+    } while (!lineContent.starts_with("[TASK"));
 
+    AssignmentReadState assignmentState;
+    for (size_t lineStart = cursor.position; nextLine(cursor, lineContent);
+         lineStart = cursor.position) {
         if (lineContent.empty() || lineContent == "---") {
-            params.lineIndex++;
             continue;
         }
 
-        if (lineContent.find("[TASK") == 0 &&
-            params.taskIndex < params.taskCount - 1) {
+        if (lineContent.starts_with("[TASK") && taskIndex < taskCount - 1) {
+            cursor.position = lineStart;
             break;
         }
 
-        TaskFieldData fieldData;
-        parseTaskField(lineContent, fieldData);
-        updateTaskDataFromField(params.taskData, fieldData);
-
-        processTaskAssignmentLine(lineContent, params.taskData.assignments,
-                                  assignmentsRead, assignmentsCount,
-                                  readingAssignments);
-
-        params.lineIndex++;
+        parseTaskField(lineContent, taskData);
+        processTaskAssignmentLine(lineContent, taskData.assignments,
+                                  assignmentState);
     }
 
     return true;
@@ -354,7 +274,7 @@ static bool isValidTaskData(const TaskData& taskData) {
 
 static bool taskExistsInProject(const Company& company, int projectId,
                                 int taskId) {
-    auto existingTasks = company.getProjectTasks(projectId);
+    auto existingTasks = company.getProjectTasksView(projectId);
     return std::ranges::contains(existingTasks, taskId, &Task::getId);
 }
 
@@ -368,8 +288,8 @@ static void addTaskWithDeadlineException(Company& company,
         task.setAllocatedHours(taskData.allocatedHours);
         project->getTasks().push_back(task);
         project->recomputeTotalsFromTasks();
-        processTaskAssignments(company, taskData.projectId, taskData.taskId,
-                               taskData.assignments);
+        company.restoreTaskAssignments(taskData.projectId, taskData.taskId,
+                                       taskData.assignments);
     }
 }
 
@@ -418,15 +338,11 @@ static bool tryAddTaskToCompany(Company& company, const TaskData& taskData) {
     }
 }
 
-static void processTasks(Company& company,
-                         const std::vector<std::string>& lines, int startIndex,
+static void processTasks(Company& company, TextCursor& cursor,
                          int taskCount) {
-    int lineIndex = startIndex;
-    for (int i = 0; i < taskCount && lineIndex < static_cast<int>(lines.size());
-         ++i) {
+    for (int i = 0; i < taskCount && !isAtEnd(cursor); ++i) {
         TaskData taskData;
-        if (ProcessTaskParams params{lines, lineIndex, i, taskCount, taskData};
-            !processTask(params)) {
+        if (!processTask(cursor, i, taskCount, taskData)) {
             break;
         }
 
@@ -449,37 +365,16 @@ static void processTasks(Company& company,
 
 static void collectEmployeeTaskAssignments(
     const Company& company, int employeeId,
-    const std::vector<Project>& projects,
     std::vector<std::tuple<int, int, int, int>>& assignments) {
-    if (assignments.size() >= static_cast<size_t>(kMaxLargeAssignments)) {
-        return;
-    }
-
-    for (const auto& project : projects) {
-        if (assignments.size() >= static_cast<size_t>(kMaxLargeAssignments)) {
-            break;
-        }
-
-        auto projectId = project.getId();
-        auto tasks = company.getProjectTasks(projectId);
-
-        for (const auto& task : tasks) {
-            if (assignments.size() >=
-                static_cast<size_t>(kMaxLargeAssignments)) {
-                break;
-            }
-
-            int taskHours =
-                company.getEmployeeHours(employeeId, projectId, task.getId());
-
-            if (taskHours <= 0) {
-                continue;
+    company.getAssignmentStore().forEachOfEmployee(
+        employeeId,
+        [employeeId, &assignments](int projectId, int taskId, int hours) {
+            if (hours <= 0 || assignments.size() >=
+                                  static_cast<size_t>(kMaxLargeAssignments)) {
+                return;
             }
-
-            assignments.push_back(std::make_tuple(employeeId, projectId,
-                                                  task.getId(), taskHours));
-        }
-    }
+            assignments.emplace_back(employeeId, projectId, taskId, hours);
+        });
 }
 
 template <typename T>
@@ -619,10 +514,7 @@ Company FileManager::loadFromFile(const QString& fileName) {
     Company company = loadSingleCompany(fileStream);
     fileStream.close();
 
-    company.fixTaskAssignmentsToCapacity();
-
-    company.recalculateTaskAllocatedHours();
-
+    company.normalizeLoadedData();
     return company;
 }
 
@@ -655,7 +547,7 @@ Company FileManager::loadSingleCompany(std::ifstream& fileStream) {
 
 void FileManager::saveEmployeesToStream(const Company& company,
                                         std::ofstream& fileStream) {
-    auto employees = company.getAllEmployees();
+    auto employees = company.getEmployeesView();
     for (const auto& employee : employees) {
         if (auto manager = std::dynamic_pointer_cast<Manager>(employee)) {
             fileStream << "MANAGER\n";
@@ -727,7 +619,7 @@ void FileManager::loadEmployeesFromStream(Company& company,
 
 void FileManager::saveProjectsToStream(const Company& company,
                                        std::ofstream& fileStream) {
-    auto projects = company.getAllProjects();
+    auto projects = company.getProjectsView();
     for (const auto& project : projects) {
         fileStream << "[PROJECT]\n";
         saveProjectToStream(project, fileStream);
@@ -807,7 +699,7 @@ void FileManager::saveEmployees(const Company& company,
         throw FileManagerException("Cannot open file for writing: " + fileName);
     }
 
-    auto employees = company.getAllEmployees();
+    auto employees = company.getEmployeesView();
 
     if (employees.size() > static_cast<size_t>(kMaxEmployees)) {
         fileStream.close();
@@ -863,8 +755,6 @@ void FileManager::saveEmployeeToStream(std::shared_ptr<Employee> employee,
 }
 
 void FileManager::loadEmployees(Company& company, const QString& fileName) {
-    employeeStatusesFromFile.clear();
-
     std::ifstream fileStream(fileName.toStdString());
     if (!fileStream.is_open()) {
         throw FileManagerException("Cannot open file for reading: " + fileName);
@@ -935,7 +825,6 @@ std::shared_ptr<Employee> FileManager::loadEmployeeFromStream(
     }
 
     if (employee) {
-        employeeStatusesFromFile[baseData.id] = baseData.isActive;
         employee->setIsActive(baseData.isActive);
     }
 
@@ -949,7 +838,7 @@ void FileManager::saveProjects(const Company& company,
         throw FileManagerException("Cannot open file for writing: " + fileName);
     }
 
-    auto projects = company.getAllProjects();
+    auto projects = company.getProjectsView();
 
     if (projects.size() > static_cast<size_t>(kMaxProjects)) {
         fileStream.close();
@@ -1059,12 +948,11 @@ void FileManager::saveTasks(const Company& company, const QString& fileName) {
                                    tempFileName);
     }
 
-    auto projects = company.getAllProjects();
-    auto employees = company.getAllEmployees();
+    auto projects = company.getProjectsView();
 
     size_t totalTasksCount = 0;
     for (const auto& project : projects) {
-        auto tasks = company.getProjectTasks(project.getId());
+        auto tasks = company.getProjectTasksView(project.getId());
         totalTasksCount += tasks.size();
         if (totalTasksCount > static_cast<size_t>(kMaxTasks)) {
             throw FileManagerException(
@@ -1073,26 +961,7 @@ void FileManager::saveTasks(const Company& company, const QString& fileName) {
         }
     }
 
-    std::vector<std::tuple<int, int, QString, QString, int, int, int, QString,
-                           std::vector<std::pair<int, int>>>>
-        allTasks;
-    allTasks.reserve(std::min(totalTasksCount, static_cast<size_t>(kMaxTasks)));
-
-    for (const auto& project : projects) {
-        auto tasks = company.getProjectTasks(project.getId());
-        for (const auto& task : tasks) {
-            std::vector<std::pair<int, int>> assignments;
-            collectTaskAssignments(company, project.getId(), task.getId(),
-                                   employees, assignments);
-
-            allTasks.emplace_back(project.getId(), task.getId(), task.getName(),
-                                  task.getType(), task.getEstimatedHours(),
-                                  task.getAllocatedHours(), task.getPriority(),
-                                  task.getPhase(), assignments);
-        }
-    }
-
-    fileStream << "TASKS_COUNT:" << allTasks.size() << "\n";
+    fileStream << "TASKS_COUNT:" << totalTasksCount << "\n";
     fileStream << "FORMAT_VERSION:2\n";
     fileStream << "---\n";
 
@@ -1103,37 +972,45 @@ void FileManager::saveTasks(const Company& company, const QString& fileName) {
                                    fileName);
     }
 
-    for (size_t i = 0; i < allTasks.size(); ++i) {
-        const auto& [projectId, taskId, taskName, taskType, estimatedHours,
-                     allocatedHours, priority, phase, assignments] =
-            allTasks[i];
-
-        fileStream << "\n[TASK " << (i + 1) << "]\n";
-        fileStream << "PROJECT_ID:" << projectId << "\n";
-        fileStream << "TASK_ID:" << taskId << "\n";
-        fileStream << "NAME:" << taskName.toStdString() << "\n";
-        fileStream << "TYPE:" << taskType.toStdString() << "\n";
-        fileStream << "ESTIMATED_HOURS:" << estimatedHours << "\n";
-        fileStream << "ALLOCATED_HOURS:" << allocatedHours << "\n";
-        fileStream << "PRIORITY:" << priority << "\n";
-        fileStream << "PHASE:" << phase.toStdString() << "\n";
-        fileStream << "ASSIGNMENTS_COUNT:" << assignments.size() << "\n";
-
-        if (!assignments.empty()) {
-            fileStream << "ASSIGNMENTS:\n";
-            int j = 1;
-            for (const auto& [empId, hours] : assignments) {
-                fileStream << "  [" << j << "] EMPLOYEE_ID:" << empId
-                           << " HOURS:" << hours << "\n";
-                j++;
+    size_t taskNumber = 0;
+    for (const auto& project : projects) {
+        auto assignmentsByTask =
+            groupProjectAssignmentsByTask(company, project.getId());
+
+        for (const auto& task : company.getProjectTasksView(project.getId())) {
+            fileStream << "\n[TASK " << ++taskNumber << "]\n";
+            fileStream << "PROJECT_ID:" << project.getId() << "\n";
+            fileStream << "TASK_ID:" << task.getId() << "\n";
+            fileStream << "NAME:" << task.getName().toStdString() << "\n";
+            fileStream << "TYPE:" << task.getType().toStdString() << "\n";
+            fileStream << "ESTIMATED_HOURS:" << task.getEstimatedHours()
+                       << "\n";
+            fileStream << "ALLOCATED_HOURS:" << task.getAllocatedHours()
+                       << "\n";
+            fileStream << "PRIORITY:" << task.getPriority() << "\n";
+            fileStream << "PHASE:" << task.getPhase().toStdString() << "\n";
+
+            auto it = assignmentsByTask.find(task.getId());
+            size_t assignmentCount =
+                it == assignmentsByTask.end() ? 0 : it->second.size();
+            fileStream << "ASSIGNMENTS_COUNT:" << assignmentCount << "\n";
+
+            if (assignmentCount > 0) {
+                fileStream << "ASSIGNMENTS:\n";
+                int j = 1;
+                for (const auto& [empId, hours] : it->second) {
+                    fileStream << "  [" << j << "] EMPLOYEE_ID:" << empId
+                               << " HOURS:" << hours << "\n";
+                    j++;
+                }
             }
-        }
 
-        if (!fileStream.good()) {
-            fileStream.close();
-            QFile::remove(tempFileName);
-            throw FileManagerException("Error writing task data to file: " +
-                                       fileName);
+            if (!fileStream.good()) {
+                fileStream.close();
+                QFile::remove(tempFileName);
+                throw FileManagerException(
+                    "Error writing task data to file: " + fileName);
+            }
         }
     }
 
@@ -1159,23 +1036,25 @@ void FileManager::loadTasks(Company& company, const QString& fileName) {
         return;
     }
 
-    std::vector<std::string> lines = readFileLines(fileName);
-    if (lines.empty()) {
-        return;
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        throw FileManagerException("Cannot open file for reading: " + fileName);
     }
 
-    int lastHeaderIndex = -1;
-    int taskCount = 0;
-    if (!findTaskHeader(lines, lastHeaderIndex, taskCount) || taskCount == 0) {
-        return;
-    }
+    QByteArray fallback;
+    std::string_view contents = mapFileContents(file, fallback);
 
-    if (taskCount < 0 || taskCount > kMaxTasks) {
+    size_t headerPosition = 0;
+    int taskCount = 0;
+    if (!findTaskHeader(contents, headerPosition, taskCount) ||
+        taskCount == 0) {
         return;
     }
 
-    int startIndex = calculateStartIndex(lines, lastHeaderIndex);
-    processTasks(company, lines, startIndex, taskCount);
+    TaskAssignmentManager::BulkLoad bulkLoad(company.getTaskManager());
+    TextCursor cursor{contents, headerPosition};
+    skipTaskHeader(cursor);
+    processTasks(company, cursor, taskCount);
 }
 
 void FileManager::saveTaskAssignments(const Company& company,
@@ -1185,8 +1064,7 @@ void FileManager::saveTaskAssignments(const Company& company,
         throw FileManagerException("Cannot open file for writing: " + fileName);
     }
 
-    auto employees = company.getAllEmployees();
-    auto projects = company.getAllProjects();
+    auto employees = company.getEmployeesView();
 
     std::vector<std::tuple<int, int, int, int>> assignments;
     assignments.reserve(std::min(static_cast<size_t>(kMaxLargeAssignments),
@@ -1199,8 +1077,7 @@ void FileManager::saveTaskAssignments(const Company& company,
             break;
         }
 
-        collectEmployeeTaskAssignments(company, emp->getId(), projects,
-                                       assignments);
+        collectEmployeeTaskAssignments(company, emp->getId(), assignments);
     }
 
     fileStream << assignments.size() << "\n";
@@ -1260,17 +1137,11 @@ static bool loadSingleAssignment(Company& company, std::ifstream& fileStream) {
         return false;
     }
 
-    try {
-        company.restoreTaskAssignment(employeeId, projectId, taskId, hours);
-        return true;
-    } catch (const CompanyException&) {
-        try {
-            company.assignEmployeeToTask(employeeId, projectId, taskId, hours);
-            return true;
-        } catch (const CompanyException&) {
-            return false;
-        }
+    if (!TaskAssignmentStore::canPack(employeeId, projectId, taskId)) {
+        return false;
     }
+    company.restoreTaskAssignment(employeeId, projectId, taskId, hours);
+    return true;
 }
 
 void FileManager::loadTaskAssignments(Company& company,
@@ -1302,6 +1173,7 @@ void FileManager::loadTaskAssignments(Company& company,
         return;
     }
 
+    TaskAssignmentManager::BulkLoad bulkLoad(company.getTaskManager());
     for (int i = 0; i < assignmentCount; ++i) {
         if (!loadSingleAssignment(company, fileStream)) {
             continue;
@@ -1309,8 +1181,4 @@ void FileManager::loadTaskAssignments(Company& company,
     }
 
     fileStream.close();
-
-    company.fixTaskAssignmentsToCapacity();
-
-    company.recalculateTaskAllocatedHours();
 }
@@ -28,12 +28,11 @@ void EmployeeService::recalculateEmployeeHours() const {
         }
     }
 
-    auto allAssignments = company->getAllTaskAssignments();
-    for (const auto& [key, hours] : allAssignments) {
-        const auto& [employeeId, projectId, taskId] = key;
-
-        std::shared_ptr<Employee> employee = company->getEmployee(employeeId);
-        if (employee && employee->getIsActive() && hours > 0) {
+    const auto& store = company->getAssignmentStore();
+    for (const auto& employee : employees) {
+        if (!employee || !employee->getIsActive()) continue;
+        if (int hours = store.getEmployeeTotalHours(employee->getId());
+            hours > 0) {
             try {
                 employee->addWeeklyHours(hours);
             } catch (const EmployeeException& e) {
@@ -45,15 +44,5 @@ void EmployeeService::recalculateEmployeeHours() const {
 }
 
 int EmployeeService::calculateTotalAssignedHours(int employeeId) const {
-    auto totalHours = 0;
-    auto allAssignments = company->getAllTaskAssignments();
-
-    for (const auto& [key, hours] : allAssignments) {
-        const auto& [empId, projectId, taskId] = key;
-        if (empId == employeeId) {
-            totalHours += hours;
-        }
-    }
-
-    return totalHours;
+    return company->getAssignmentStore().getEmployeeTotalHours(employeeId);
 }
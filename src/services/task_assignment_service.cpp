@@ -10,6 +10,7 @@
 #include <tuple>
 #include <vector>
 
+#include "entities/assignment_candidate_index.h"
 #include "exceptions/exceptions.h"
 #include "services/cost_calculation_service.h"
 #include "utils/company_utils.h"
@@ -32,10 +33,7 @@ struct AssignEmployeeToTaskInPoolParams {
 struct ProcessTaskAssignmentParams {
     Task& task;
     int projectId;
-    const QString& projectPhase;
-    double projectBudget;
-    double projectEstimatedHours;
-    const std::vector<std::shared_ptr<Employee>>& employeesList;
+    AssignmentCandidateIndex& candidates;
     std::map<int, int>& employeeUsage;
     double& currentEmployeeCosts;
     double& remainingBudget;
@@ -266,28 +264,24 @@ TaskAssignmentService::TaskAssignmentService(Company* company)
     }
 }
 
+bool TaskAssignmentService::roleMatchesSDLCStage(EmployeeType role,
+                                                 ProjectPhase projectPhase) {
+    if (projectPhase == ProjectPhase::Deployment) {
+        return role == EmployeeType::Manager;
+    }
+    return ::roleMatchesSDLCStage(role, projectPhase);
+}
+
 bool TaskAssignmentService::roleMatchesSDLCStage(
     const QString& employeePosition, const QString& projectPhase) {
-    if (projectPhase == "Deployment") {
-        return employeePosition == "Manager";
-    }
-    if (projectPhase == "Maintenance") {
-        return true;
-    }
-    return roleMatchesSDLCStage(employeePosition, projectPhase);
+    return roleMatchesSDLCStage(employeeTypeFromString(employeePosition),
+                                projectPhaseFromString(projectPhase));
 }
 
 bool TaskAssignmentService::taskTypeMatchesEmployeeType(
     const QString& taskType, const QString& employeeType) {
-    static const std::map<QString, QString> typeMapping = {
-        {"Management", "Manager"},
-        {"Development", "Developer"},
-        {"Design", "Designer"},
-        {"QA", "QA"}};
-    if (const auto& it = typeMapping.find(taskType); it != typeMapping.end()) {
-        return it->second == employeeType;
-    }
-    return false;
+    return ::taskTypeMatchesEmployeeType(taskTypeFromString(taskType),
+                                         employeeTypeFromString(employeeType));
 }
 
 void TaskAssignmentService::assignEmployeeToTask(int employeeId, int projectId,
@@ -401,27 +395,18 @@ void TaskAssignmentService::restoreTaskAssignment(int employeeId, int projectId,
 }
 
 void TaskAssignmentService::removeEmployeeTaskAssignments(int employeeId) {
-    auto allAssignments = company->getAllTaskAssignments();
-
-    for (const auto& [key, hours] : allAssignments) {
-        const auto [empId, projectId, taskId] = key;
-        if (empId == employeeId) {
-            company->getTaskManager().removeTaskAssignment(employeeId,
-                                                           projectId, taskId);
-        }
-    }
+    company->getTaskManager().removeEmployeeTaskAssignments(employeeId);
 }
 
 static void collectEmployeeAssignments(
     const Company* company,
     std::map<int, std::vector<std::tuple<int, int, int, int>>>&
         employeeAssignments) {
-    auto allAssignments = company->getAllTaskAssignments();
-    for (const auto& [key, hours] : allAssignments) {
-        const auto& [employeeId, projectId, taskId] = key;
-        employeeAssignments[employeeId].emplace_back(projectId, taskId, hours,
-                                                     0);
-    }
+    company->getAssignmentStore().forEach(
+        [&](int employeeId, int projectId, int taskId, int hours) {
+            employeeAssignments[employeeId].emplace_back(projectId, taskId,
+                                                         hours, 0);
+        });
 }
 
 static int calculateTotalHours(
@@ -551,21 +536,18 @@ static void collectScaledAssignmentsForEmployee(
     const Company* company, int employeeId, double scaleFactor,
     std::vector<std::tuple<int, int, int, int>>& assignmentsData,
     int& totalScaledHours) {
-    auto allAssignments = company->getAllTaskAssignments();
-    for (const auto& assignment : allAssignments) {
-        const auto& [key, oldHours] = assignment;
-        const auto& [empId, projectId, taskId] = key;
-        if (empId != employeeId) {
-            continue;
-        }
-        auto scaledHours = static_cast<int>(std::round(oldHours * scaleFactor));
-        if (scaledHours < 0) {
-            scaledHours = 0;
-        }
+    company->getAssignmentStore().forEachOfEmployee(
+        employeeId, [&](int projectId, int taskId, int oldHours) {
+            auto scaledHours =
+                static_cast<int>(std::round(oldHours * scaleFactor));
+            if (scaledHours < 0) {
+                scaledHours = 0;
+            }
 
-        assignmentsData.emplace_back(projectId, taskId, oldHours, scaledHours);
-        totalScaledHours += scaledHours;
-    }
+            assignmentsData.emplace_back(projectId, taskId, oldHours,
+                                         scaledHours);
+            totalScaledHours += scaledHours;
+        });
 }
 
 static void updateTaskAssignmentsFromScaledData(
@@ -598,14 +580,8 @@ static void updateEmployeeHoursAfterScaling(
 
     const int currentCapacity = employee->getWeeklyHoursCapacity();
 
-    int totalHours = 0;
-    auto allAssignments = company->getAllTaskAssignments();
-    for (const auto& [key, hours] : allAssignments) {
-        const auto& [empId, projId, tId] = key;
-        if (empId == employeeId) {
-            totalHours += hours;
-        }
-    }
+    int totalHours =
+        company->getAssignmentStore().getEmployeeTotalHours(employeeId);
 
     if (totalHours > currentCapacity) {
         totalHours = currentCapacity;
@@ -689,18 +665,10 @@ static int compareTaskPriority(const Task& taskA, const Task& taskB) {
 }
 
 static bool employeeRoleMatchesSDLC(const std::shared_ptr<Employee>& employee,
-                                    const QString& projectPhase) {
-    if (!employee) return false;
-    QString pos = employee->getPosition();
-    return TaskAssignmentService::roleMatchesSDLCStage(pos, projectPhase);
-}
-
-static bool employeeTaskTypeMatches(const std::shared_ptr<Employee>& employee,
-                                    const QString& taskType) {
+                                    ProjectPhase projectPhase) {
     if (!employee) return false;
-    QString employeeType = employee->getEmployeeType();
-    return TaskAssignmentService::taskTypeMatchesEmployeeType(taskType,
-                                                              employeeType);
+    return TaskAssignmentService::roleMatchesSDLCStage(employee->getTypeCode(),
+                                                       projectPhase);
 }
 
 static std::vector<size_t> prepareTaskIndices(const std::vector<Task>& tasks) {
@@ -717,27 +685,10 @@ static std::vector<size_t> prepareTaskIndices(const std::vector<Task>& tasks) {
     return taskIndices;
 }
 
-static std::vector<std::shared_ptr<Employee>> buildActiveEmployeesList(
-    const Company* company) {
-    std::vector<std::shared_ptr<Employee>> employeesList;
-    auto allEmployees = company->getAllEmployees();
-    for (const auto& emp : allEmployees) {
-        if (emp && emp->getIsActive()) {
-            employeesList.push_back(emp);
-        }
-    }
-    return employeesList;
-}
-
-static bool isEmployeeEligibleForTask(const std::shared_ptr<Employee>& employee,
-                                      const QString& projectPhase,
-                                      const QString& taskType,
-                                      double projectBudget,
-                                      double maxAffordableHourlyRate,
-                                      double projectEstimatedHours) {
-    if (!employee) return false;
-    if (!employeeRoleMatchesSDLC(employee, projectPhase)) return false;
-    if (!employeeTaskTypeMatches(employee, taskType)) return false;
+static bool isEmployeeAffordable(const std::shared_ptr<Employee>& employee,
+                                 double projectBudget,
+                                 double maxAffordableHourlyRate,
+                                 double projectEstimatedHours) {
     if (employee->getSalary() > projectBudget) return false;
 
     if (projectEstimatedHours > 0) {
@@ -750,6 +701,22 @@ static bool isEmployeeEligibleForTask(const std::shared_ptr<Employee>& employee,
     return true;
 }
 
+static std::vector<std::shared_ptr<Employee>> collectAssignmentCandidates(
+    const Company* company, ProjectPhase projectPhase, double projectBudget,
+    double maxAffordableHourlyRate, double projectEstimatedHours) {
+    std::vector<std::shared_ptr<Employee>> candidates;
+    for (const auto& employee : company->getEmployeesView()) {
+        if (!employee || !employee->getIsActive()) continue;
+        if (!employeeRoleMatchesSDLC(employee, projectPhase)) continue;
+        if (isEmployeeAffordable(employee, projectBudget,
+                                 maxAffordableHourlyRate,
+                                 projectEstimatedHours)) {
+            candidates.push_back(employee);
+        }
+    }
+    return candidates;
+}
+
 static int getTrulyAvailableHours(const std::shared_ptr<Employee>& employee,
                                   const std::map<int, int>& employeeUsage) {
     if (!employee) return 0;
@@ -762,27 +729,6 @@ static int getTrulyAvailableHours(const std::shared_ptr<Employee>& employee,
     return available - alreadyUsed;
 }
 
-static std::vector<std::shared_ptr<Employee>> buildEmployeePool(
-    const std::vector<std::shared_ptr<Employee>>& employeesList,
-    const QString& projectPhase, const QString& taskType, double projectBudget,
-    double maxAffordableHourlyRate, double projectEstimatedHours,
-    const std::map<int, int>& employeeUsage) {
-    std::vector<std::shared_ptr<Employee>> pool;
-    for (const auto& employee : employeesList) {
-        if (!isEmployeeEligibleForTask(employee, projectPhase, taskType,
-                                       projectBudget, maxAffordableHourlyRate,
-                                       projectEstimatedHours)) {
-            continue;
-        }
-
-        int trulyAvailable = getTrulyAvailableHours(employee, employeeUsage);
-        if (trulyAvailable > 0) {
-            pool.push_back(employee);
-        }
-    }
-    return pool;
-}
-
 static int calculateToAssignHours(int remaining, int trulyAvailable,
                                   int maxAffordableHours) {
     int toAssign = remaining;
@@ -845,28 +791,19 @@ static void processTaskAssignment(const ProcessTaskAssignmentParams& params) {
         return;
     }
 
-    double averageBudgetPerHour = 0.0;
-    if (params.projectEstimatedHours > 0) {
-        averageBudgetPerHour =
-            params.projectBudget / params.projectEstimatedHours;
+    EmployeeType requiredType =
+        getRequiredEmployeeType(params.task.getTypeCode());
+    if (requiredType == EmployeeType::Unknown) {
+        return;
     }
-    double maxAffordableHourlyRate = averageBudgetPerHour * 0.7;
-    auto taskType = params.task.getType();
 
-    std::vector<std::shared_ptr<Employee>> pool =
-        buildEmployeePool(params.employeesList, params.projectPhase, taskType,
-                          params.projectBudget, maxAffordableHourlyRate,
-                          params.projectEstimatedHours, params.employeeUsage);
+    std::vector<AssignmentCandidateIndex::Candidate> visited;
+    while (remaining > 0) {
+        auto candidate = params.candidates.popBest(requiredType);
+        if (!candidate) break;
+        const auto& poolEmployee =
+            visited.emplace_back(std::move(*candidate)).employee;
 
-    if (!pool.empty()) {
-        std::ranges::sort(pool, [&params](const std::shared_ptr<Employee>& a,
-                                          const std::shared_ptr<Employee>& b) {
-            return compareEmployeesForSorting(a, b, params.employeeUsage) < 0;
-        });
-    }
-
-    for (const auto& poolEmployee : pool) {
-        if (remaining <= 0) break;
         AssignEmployeeToTaskInPoolParams assignParams{
             poolEmployee,
             params.task,
@@ -878,6 +815,12 @@ static void processTaskAssignment(const ProcessTaskAssignmentParams& params) {
             params.company};
         assignEmployeeToTaskInPool(assignParams);
     }
+
+    for (auto& candidate : visited) {
+        candidate.availableHours =
+            getTrulyAvailableHours(candidate.employee, params.employeeUsage);
+        params.candidates.push(std::move(candidate));
+    }
 }
 
 static void calculateAndApplyTotalCosts(Project* projPtr,
@@ -899,33 +842,37 @@ void TaskAssignmentService::autoAssignEmployeesToProject(int projectId) {
     Project* projPtr = company->getProject(projectId);
     if (!projPtr) throw CompanyException("Project not found");
 
-    auto projectPhase = projPtr->getPhase();
-    if (projectPhase == "Completed") {
+    auto projectPhase = projPtr->getPhaseCode();
+    if (projectPhase == ProjectPhase::Completed) {
         throw CompanyException("Cannot auto-assign to project with phase: " +
-                               projectPhase);
+                               projPtr->getPhase());
     }
 
     std::vector<Task>& tasks = projPtr->getTasks();
     if (tasks.empty()) throw CompanyException("No tasks in project");
 
     std::vector<size_t> taskIndices = prepareTaskIndices(tasks);
-    std::vector<std::shared_ptr<Employee>> employeesList =
-        buildActiveEmployeesList(company);
     std::map<int, int> employeeUsage;
 
     auto currentEmployeeCosts = projPtr->getEmployeeCosts();
     auto remainingBudget = projPtr->getBudget() - currentEmployeeCosts;
     double projectBudget = projPtr->getBudget();
     double projectEstimatedHours = projPtr->getEstimatedHours();
+    double maxAffordableHourlyRate = 0.0;
+    if (projectEstimatedHours > 0) {
+        maxAffordableHourlyRate = projectBudget / projectEstimatedHours * 0.7;
+    }
+
+    AssignmentCandidateIndex candidates(
+        collectAssignmentCandidates(company, projectPhase, projectBudget,
+                                    maxAffordableHourlyRate,
+                                    projectEstimatedHours));
 
     for (const auto taskIndex : taskIndices) {
         Task& task = tasks[taskIndex];
         ProcessTaskAssignmentParams processParams{task,
                                                   projectId,
-                                                  projectPhase,
-                                                  projectBudget,
-                                                  projectEstimatedHours,
-                                                  employeesList,
+                                                  candidates,
                                                   employeeUsage,
                                                   currentEmployeeCosts,
                                                   remainingBudget,
@@ -942,17 +889,15 @@ bool TaskAssignmentService::validateAssignment(
     if (!employee || !project) return false;
 
     if (!employee->getIsActive()) return false;
-    if (project->getPhase() == "Completed") return false;
+    if (project->getPhaseCode() == ProjectPhase::Completed) return false;
 
     if (hours > task.getEstimatedHours()) return false;
 
-    if (const QString employeePosition = employee->getPosition();
-        !roleMatchesSDLCStage(employeePosition, project->getPhase()))
+    if (!roleMatchesSDLCStage(employee->getTypeCode(), project->getPhaseCode()))
         return false;
 
-    const QString taskType = task.getType();
-    if (const QString employeeType = employee->getEmployeeType();
-        !taskTypeMatchesEmployeeType(taskType, employeeType))
+    if (!::taskTypeMatchesEmployeeType(task.getTypeCode(),
+                                       employee->getTypeCode()))
         return false;
 
     if (!employee->isAvailable(hours)) return false;
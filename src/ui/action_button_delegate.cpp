@@ -0,0 +1,92 @@
+#include "ui/action_button_delegate.h"
+
+#include <QAbstractItemView>
+#include <QApplication>
+#include <QMenu>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QStyle>
+#include <QStyleOptionButton>
+#include <algorithm>
+#include <utility>
+
+#include "utils/consts.h"
+
+ActionButtonDelegate::ActionButtonDelegate(QAbstractItemView* view,
+                                           MenuBuilder buildMenu)
+    : QStyledItemDelegate(view), view(view), buildMenu(std::move(buildMenu)) {}
+
+QRect ActionButtonDelegate::buttonRect(const QRect& cell) {
+    const int width = std::min(kActionButtonWidth, cell.width() - 8);
+    const int height = std::min(kActionButtonHeight, cell.height() - 8);
+    QRect button(0, 0, std::max(width, 0), std::max(height, 0));
+    button.moveCenter(cell.center());
+    return button;
+}
+
+void ActionButtonDelegate::paint(QPainter* painter,
+                                 const QStyleOptionViewItem& option,
+                                 const QModelIndex& index) const {
+    QStyledItemDelegate::paint(painter, option, index);
+
+    QStyleOptionButton button;
+    button.rect = buttonRect(option.rect);
+    button.text = "Actions";
+    button.features = QStyleOptionButton::HasMenu;
+    button.state = QStyle::State_Enabled | QStyle::State_Raised;
+    if (pressedIndex == index) {
+        button.state |= QStyle::State_Sunken;
+    }
+
+    const QWidget* widget = option.widget;
+    const QStyle* style = widget ? widget->style() : QApplication::style();
+    style->drawControl(QStyle::CE_PushButton, &button, painter, widget);
+}
+
+QSize ActionButtonDelegate::sizeHint(const QStyleOptionViewItem& option,
+                                     const QModelIndex& index) const {
+    QSize hint = QStyledItemDelegate::sizeHint(option, index);
+    return hint.expandedTo(
+        QSize(kActionButtonWidth + 8, kActionButtonHeight + 8));
+}
+
+bool ActionButtonDelegate::editorEvent(QEvent* event,
+                                       QAbstractItemModel* model,
+                                       const QStyleOptionViewItem& option,
+                                       const QModelIndex& index) {
+    if (event->type() != QEvent::MouseButtonPress &&
+        event->type() != QEvent::MouseButtonRelease) {
+        return QStyledItemDelegate::editorEvent(event, model, option, index);
+    }
+
+    const auto* mouseEvent = static_cast<QMouseEvent*>(event);
+    const QRect button = buttonRect(option.rect);
+    const bool onButton = mouseEvent->button() == Qt::LeftButton &&
+                          button.contains(mouseEvent->position().toPoint());
+
+    if (event->type() == QEvent::MouseButtonPress) {
+        if (!onButton) return false;
+        pressedIndex = index;
+        view->viewport()->update(option.rect);
+        return true;
+    }
+
+    const bool clicked = onButton && pressedIndex == index;
+    pressedIndex = QPersistentModelIndex();
+    view->viewport()->update(option.rect);
+    if (clicked) {
+        showMenu(index, button);
+    }
+    return clicked;
+}
+
+void ActionButtonDelegate::showMenu(const QModelIndex& index,
+                                    const QRect& button) {
+    view->setCurrentIndex(index.siblingAtColumn(0));
+
+    auto* menu = new QMenu(view);
+    menu->setAttribute(Qt::WA_DeleteOnClose);
+    menu->setMinimumWidth(button.width());
+    buildMenu(menu);
+    menu->popup(view->viewport()->mapToGlobal(button.bottomLeft()));
+}
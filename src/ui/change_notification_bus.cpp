@@ -0,0 +1,74 @@
+#include "ui/change_notification_bus.h"
+
+#include <utility>
+
+#include "entities/company.h"
+
+ChangeNotificationBus::ChangeNotificationBus(QObject* parent)
+    : QObject(parent) {
+    flushTimer.setSingleShot(true);
+    flushTimer.setInterval(0);
+    connect(&flushTimer, &QTimer::timeout, this, &ChangeNotificationBus::flush);
+}
+
+void ChangeNotificationBus::attach(Company* newCompany) {
+    flushTimer.stop();
+    changedEmployees.clear();
+    changedProjects.clear();
+    assignmentEmployees.clear();
+    assignmentProjects.clear();
+
+    company = newCompany;
+    if (company != nullptr) {
+        company->setChangeObserver(
+            [this, source = company](const ModelChange& change) {
+                post(source, change);
+            });
+        company->recalculateChanged();
+    }
+}
+
+void ChangeNotificationBus::post(const Company* source,
+                                 const ModelChange& change) {
+    if (source != company) return;
+
+    switch (change.kind) {
+        case ModelChange::Kind::EmployeeChanged:
+            changedEmployees.insert(change.employeeId);
+            break;
+        case ModelChange::Kind::ProjectChanged:
+            changedProjects.insert(change.projectId);
+            break;
+        case ModelChange::Kind::AssignmentsChanged:
+            assignmentEmployees.insert(change.employeeId);
+            assignmentProjects.insert(change.projectId);
+            break;
+    }
+
+    if (!flushTimer.isActive()) {
+        flushTimer.start();
+    }
+}
+
+void ChangeNotificationBus::flush() {
+    flushTimer.stop();
+    if (company == nullptr) return;
+    if (changedEmployees.empty() && changedProjects.empty() &&
+        assignmentEmployees.empty()) {
+        return;
+    }
+
+    company->recalculateChanged();
+
+    auto employees = std::exchange(changedEmployees, {});
+    auto projects = std::exchange(changedProjects, {});
+    auto touchedEmployees = std::exchange(assignmentEmployees, {});
+    auto touchedProjects = std::exchange(assignmentProjects, {});
+
+    if (!employees.empty()) emit employeesChanged(employees);
+    if (!projects.empty()) emit projectsChanged(projects);
+    if (!touchedProjects.empty()) {
+        emit assignmentsChanged(touchedEmployees, touchedProjects);
+    }
+    emit changesPublished();
+}
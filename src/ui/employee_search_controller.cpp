@@ -0,0 +1,67 @@
+#include "ui/employee_search_controller.h"
+
+#include <QtConcurrent>
+#include <unordered_set>
+
+#include "entities/company.h"
+#include "ui/entity_table_models.h"
+#include "utils/consts.h"
+
+EmployeeSearchController::EmployeeSearchController(
+    EntityFilterProxyModel* proxy, QObject* parent)
+    : QObject(parent), proxy(proxy) {
+    debounceTimer.setSingleShot(true);
+    debounceTimer.setInterval(kSearchDebounceMs);
+    connect(&debounceTimer, &QTimer::timeout, this,
+            &EmployeeSearchController::startSearch);
+    connect(&watcher, &QFutureWatcher<std::vector<int>>::finished, this,
+            &EmployeeSearchController::handleSearchFinished);
+}
+
+EmployeeSearchController::~EmployeeSearchController() {
+    watcher.waitForFinished();
+}
+
+void EmployeeSearchController::requestSearch(const Company* searchCompany,
+                                             const QString& searchTerm) {
+    company = searchCompany;
+    term = searchTerm;
+    debounceTimer.start();
+}
+
+void EmployeeSearchController::refresh(const Company* searchCompany) {
+    company = searchCompany;
+    debounceTimer.stop();
+    startSearch();
+}
+
+void EmployeeSearchController::startSearch() {
+    if (term.isEmpty() || company == nullptr) {
+        searchPending = searchRunning;
+        proxy->clearMatchingIds();
+        return;
+    }
+    if (searchRunning) {
+        searchPending = true;
+        return;
+    }
+
+    searchPending = false;
+    searchRunning = true;
+    watcher.setFuture(QtConcurrent::run(
+        [index = company->getEmployeeSearchIndex(), query = term] {
+            return index->search(query);
+        }));
+}
+
+void EmployeeSearchController::handleSearchFinished() {
+    searchRunning = false;
+    if (searchPending) {
+        startSearch();
+        return;
+    }
+
+    std::vector<int> matches = watcher.result();
+    proxy->setMatchingIds(
+        std::unordered_set<int>(matches.begin(), matches.end()));
+}
@@ -0,0 +1,310 @@
+#include "ui/entity_table_models.h"
+
+#include <QBrush>
+#include <QColor>
+#include <algorithm>
+#include <utility>
+
+#include "entities/company.h"
+#include "helpers/display_helper.h"
+
+EntityTableModel::EntityTableModel(QStringList headers, QObject* parent)
+    : QAbstractTableModel(parent), headers(std::move(headers)) {}
+
+int EntityTableModel::rowCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : static_cast<int>(rowIds.size());
+}
+
+int EntityTableModel::columnCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : static_cast<int>(headers.size());
+}
+
+QVariant EntityTableModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || company == nullptr) return {};
+
+    int id = rowIds[index.row()];
+    switch (role) {
+        case Qt::DisplayRole:
+            return index.column() == actionColumn()
+                       ? QVariant()
+                       : cellText(id, index.column());
+        case Qt::ForegroundRole:
+            return cellForeground(id);
+        case IdRole:
+            return id;
+        default:
+            return {};
+    }
+}
+
+QVariant EntityTableModel::headerData(int section, Qt::Orientation orientation,
+                                      int role) const {
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole ||
+        section < 0 || section >= static_cast<int>(headers.size())) {
+        return {};
+    }
+    return headers[section];
+}
+
+QVariant EntityTableModel::cellForeground(int id) const {
+    (void)id;
+    return {};
+}
+
+void EntityTableModel::setCompany(const Company* rowCompany) {
+    setRows(rowCompany,
+            rowCompany ? entityIds(*rowCompany) : std::vector<int>());
+}
+
+void EntityTableModel::refreshEntities(const std::unordered_set<int>& ids) {
+    if (company == nullptr) return;
+
+    // An edit may remove an entity and add it back, which moves it to the
+    // end of the company's list without changing membership, so the whole
+    // order is compared rather than just the changed ids.
+    if (std::vector<int> currentIds = entityIds(*company);
+        currentIds != rowIds) {
+        setRows(company, std::move(currentIds));
+        return;
+    }
+
+    std::vector<int> rows;
+    rows.reserve(ids.size());
+    for (int id : ids) {
+        if (int row = rowOf(id); row >= 0) rows.push_back(row);
+    }
+
+    std::ranges::sort(rows);
+    for (size_t first = 0; first < rows.size();) {
+        size_t last = first;
+        while (last + 1 < rows.size() && rows[last + 1] == rows[last] + 1) {
+            ++last;
+        }
+        emit dataChanged(index(rows[first], 0),
+                         index(rows[last], actionColumn() - 1));
+        first = last + 1;
+    }
+}
+
+void EntityTableModel::setRows(const Company* rowCompany,
+                               std::vector<int> ids) {
+    std::unordered_map<int, size_t> positions;
+    positions.reserve(ids.size());
+    for (size_t position = 0; position < ids.size(); ++position) {
+        positions.emplace(ids[position], position);
+    }
+
+    if (rowCompany != company || !keepsSurvivorOrder(positions)) {
+        beginResetModel();
+        company = rowCompany;
+        rowIds = std::move(ids);
+        rebuildRowIndex();
+        endResetModel();
+        return;
+    }
+
+    removeMissingRows(positions);
+    insertNewRows(ids);
+    rebuildRowIndex();
+
+    if (!rowIds.empty()) {
+        emit dataChanged(index(0, 0),
+                         index(static_cast<int>(rowIds.size()) - 1,
+                               actionColumn() - 1));
+    }
+}
+
+int EntityTableModel::idAt(int row) const {
+    if (row < 0 || row >= static_cast<int>(rowIds.size())) return -1;
+    return rowIds[row];
+}
+
+int EntityTableModel::rowOf(int id) const {
+    auto found = rowById.find(id);
+    return found == rowById.end() ? -1 : found->second;
+}
+
+bool EntityTableModel::keepsSurvivorOrder(
+    const std::unordered_map<int, size_t>& positions) const {
+    size_t previous = 0;
+    bool first = true;
+    for (int id : rowIds) {
+        auto found = positions.find(id);
+        if (found == positions.end()) continue;
+        if (!first && found->second <= previous) return false;
+        previous = found->second;
+        first = false;
+    }
+    return true;
+}
+
+void EntityTableModel::removeMissingRows(
+    const std::unordered_map<int, size_t>& positions) {
+    int last = static_cast<int>(rowIds.size()) - 1;
+    while (last >= 0) {
+        if (positions.contains(rowIds[last])) {
+            --last;
+            continue;
+        }
+        int first = last;
+        while (first > 0 && !positions.contains(rowIds[first - 1])) {
+            --first;
+        }
+        beginRemoveRows(QModelIndex(), first, last);
+        rowIds.erase(rowIds.begin() + first, rowIds.begin() + last + 1);
+        endRemoveRows();
+        last = first - 1;
+    }
+}
+
+void EntityTableModel::insertNewRows(const std::vector<int>& ids) {
+    size_t row = 0;
+    size_t next = 0;
+    while (next < ids.size()) {
+        if (row < rowIds.size() && rowIds[row] == ids[next]) {
+            ++row;
+            ++next;
+            continue;
+        }
+        size_t runEnd = next;
+        while (runEnd < ids.size() &&
+               (row >= rowIds.size() || rowIds[row] != ids[runEnd])) {
+            ++runEnd;
+        }
+        int first = static_cast<int>(row);
+        int count = static_cast<int>(runEnd - next);
+        beginInsertRows(QModelIndex(), first, first + count - 1);
+        rowIds.insert(rowIds.begin() + first, ids.begin() + next,
+                      ids.begin() + runEnd);
+        endInsertRows();
+        row += count;
+        next = runEnd;
+    }
+}
+
+void EntityTableModel::rebuildRowIndex() {
+    rowById.clear();
+    rowById.reserve(rowIds.size());
+    for (size_t row = 0; row < rowIds.size(); ++row) {
+        rowById.emplace(rowIds[row], static_cast<int>(row));
+    }
+}
+
+EmployeeTableModel::EmployeeTableModel(QObject* parent)
+    : EntityTableModel({"ID", "Name", "Department", "Salary", "Type",
+                        "Project", "Actions"},
+                       parent) {}
+
+std::vector<int> EmployeeTableModel::entityIds(
+    const Company& rowCompany) const {
+    auto employees = rowCompany.getEmployeesView();
+    std::vector<int> ids;
+    ids.reserve(employees.size());
+    for (const auto& employee : employees) {
+        ids.push_back(employee->getId());
+    }
+    return ids;
+}
+
+QVariant EmployeeTableModel::cellText(int id, int column) const {
+    auto employee = company->getEmployee(id);
+    if (!employee) return {};
+
+    switch (column) {
+        case 0:
+            return QString::number(employee->getId());
+        case 1:
+            return employee->getName();
+        case 2:
+            return employee->getDepartment();
+        case 3:
+            return QString::number(employee->getSalary(), 'f', 2);
+        case 4:
+            return employee->getEmployeeType();
+        case 5:
+            return DisplayHelper::formatProjectInfo(employee, company);
+        default:
+            return {};
+    }
+}
+
+QVariant EmployeeTableModel::cellForeground(int id) const {
+    if (auto employee = company->getEmployee(id);
+        employee && !employee->getIsActive()) {
+        return QBrush(QColor("#666666"));
+    }
+    return {};
+}
+
+ProjectTableModel::ProjectTableModel(QObject* parent)
+    : EntityTableModel({"ID", "Name", "Phase", "Budget", "Est. Hours",
+                        "Alloc. Hours", "Client", "Actions"},
+                       parent) {}
+
+std::vector<int> ProjectTableModel::entityIds(
+    const Company& rowCompany) const {
+    std::vector<int> ids;
+    for (const auto& project : rowCompany.getProjectsView()) {
+        ids.push_back(project.getId());
+    }
+    return ids;
+}
+
+QVariant ProjectTableModel::cellText(int id, int column) const {
+    const auto* project = company->getProject(id);
+    if (project == nullptr) return {};
+
+    switch (column) {
+        case 0:
+            return QString::number(project->getId());
+        case 1:
+            return project->getName();
+        case 2:
+            return project->getPhase();
+        case 3:
+            return QString::number(project->getBudget(), 'f', 2);
+        case 4:
+            return QString::number(project->getEstimatedHours());
+        case 5:
+            return QString::number(project->getAllocatedHours());
+        case 6:
+            return project->getClientName();
+        default:
+            return {};
+    }
+}
+
+EntityFilterProxyModel::EntityFilterProxyModel(EntityTableModel* source,
+                                               QObject* parent)
+    : QSortFilterProxyModel(parent), entities(source) {
+    setSourceModel(source);
+}
+
+// Qt 6.10 replaced invalidateFilter() with a begin/end pair around the
+// change, and deprecates the old call.
+void EntityFilterProxyModel::replaceMatchingIds(
+    std::optional<std::unordered_set<int>> ids) {
+#if QT_VERSION >= QT_VERSION_CHECK(6, 10, 0)
+    beginFilterChange();
+    matchingIds = std::move(ids);
+    endFilterChange(QSortFilterProxyModel::Direction::Rows);
+#else
+    matchingIds = std::move(ids);
+    invalidateRowsFilter();
+#endif
+}
+
+void EntityFilterProxyModel::setMatchingIds(std::unordered_set<int> ids) {
+    replaceMatchingIds(std::move(ids));
+}
+
+void EntityFilterProxyModel::clearMatchingIds() {
+    if (!matchingIds) return;
+    replaceMatchingIds(std::nullopt);
+}
+
+bool EntityFilterProxyModel::filterAcceptsRow(
+    int sourceRow, const QModelIndex& sourceParent) const {
+    (void)sourceParent;
+    return !matchingIds || matchingIds->contains(entities->idAt(sourceRow));
+}
@@ -80,7 +80,7 @@ void handleAddEmployeeButtonClick(const AddEmployeeButtonParams& params) {
             return;
         }
 
-        MainWindowDataOperations::refreshAllData(params.window);
+        MainWindowDataOperations::publishChanges(params.window);
         MainWindowDataOperations::autoSave(params.window);
         QMessageBox::information(
             &params.dialog, "Success",
@@ -133,7 +133,7 @@ void handleEditEmployeeButtonClick(const EditEmployeeButtonParams& params) {
             return;
         }
 
-        MainWindowDataOperations::refreshAllData(params.window);
+        MainWindowDataOperations::publishChanges(params.window);
         MainWindowDataOperations::autoSave(params.window);
         QMessageBox::information(&params.dialog, "Success",
                                  "Employee updated successfully!\n\n"
@@ -217,7 +217,7 @@ void handleAddProjectButtonClick(
         auto projects = window->currentCompany->getAllProjects();
         window->nextProjectId =
             IdHelper::calculateNextId(IdHelper::findMaxProjectId(projects));
-        MainWindowDataOperations::refreshAllData(window);
+        MainWindowDataOperations::publishChanges(window);
         MainWindowDataOperations::autoSave(window);
         QMessageBox::information(&dialog, "Success",
                                  "Project added successfully!\n\n"
@@ -241,12 +241,19 @@ void handleAddProjectButtonClick(
 
 MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent) {
     MainWindowUIHelper::setupUI(this);
+    autoSaver = new BackgroundAutoSaver(companies, this);
+    connect(autoSaver, &BackgroundAutoSaver::saveFailed, this,
+            [this](const QString& message) {
+                QMessageBox::warning(this, "Auto-save Error", message);
+            });
+    changeBus = new ChangeNotificationBus(this);
+    MainWindowDataOperations::connectChangeNotifications(this);
     MainWindowDataOperations::autoLoad(this);
     CompanyOperations::initializeCompanySetup(this);
 }
 
 MainWindow::~MainWindow() {
-    autoSave();
+    autoSaver->flush();
     for (auto* company : companies) {
         delete company;
     }
@@ -261,7 +268,7 @@ void MainWindow::autoSave() { MainWindowDataOperations::autoSave(this); }
 void MainWindow::autoLoad() { MainWindowDataOperations::autoLoad(this); }
 
 void MainWindow::closeEvent(QCloseEvent* event) {
-    MainWindowDataOperations::autoSave(this);
+    autoSaver->flush();
     event->accept();
 }
 
@@ -319,7 +326,7 @@ static void setupTaskComboForPendingSelection(QComboBox* taskCombo,
 static void showAutoAssignSuccessMessage(MainWindow* mainWindow,
                                          const Company* company, int projectId,
                                          int allocatedBefore) {
-    MainWindowDataOperations::refreshAllData(mainWindow);
+    MainWindowDataOperations::publishChanges(mainWindow);
     MainWindowDataOperations::selectProjectRowById(mainWindow, projectId);
 
     const auto* projectAfter = company->getProject(projectId);
@@ -347,7 +354,7 @@ static void handleAutoAssignException(MainWindow* mainWindow,
         int trackedHours = parts.size() > 1 ? parts[1].toInt() : 0;
         int actualHours = parts.size() > 2 ? parts[2].toInt() : 0;
 
-        MainWindowDataOperations::refreshAllData(mainWindow);
+        MainWindowDataOperations::publishChanges(mainWindow);
         const auto* projectAfter = company->getProject(projectId);
         int allocatedAfter =
             projectAfter ? projectAfter->getAllocatedHours() : 0;
@@ -371,7 +378,3 @@ static void handleAutoAssignException(MainWindow* mainWindow,
 void MainWindow::selectProjectRowById(int projectId) {
     MainWindowDataOperations::selectProjectRowById(this, projectId);
 }
-
-void MainWindow::validateAndFixProjectAssignments(const Company* company) {
-    MainWindowValidationHelper::validateAndFixProjectAssignments(this, company);
-}
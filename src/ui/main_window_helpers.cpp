@@ -11,9 +11,10 @@
 #include <QPushButton>
 #include <QTabWidget>
 #include <QTableWidget>
-#include <QTableWidgetItem>
 #include <QVBoxLayout>
+#include <memory>
 #include <ranges>
+#include <utility>
 
 #include "entities/company.h"
 #include "entities/employee.h"
@@ -21,7 +22,6 @@
 #include "entities/task.h"
 #include "exceptions/exception_handler.h"
 #include "exceptions/exceptions.h"
-#include "helpers/action_button_helper.h"
 #include "helpers/file_helper.h"
 #include "helpers/html_generator.h"
 #include "helpers/id_helper.h"
@@ -32,40 +32,31 @@
 #include "helpers/validation_helper.h"
 #include "managers/auto_save_loader.h"
 #include "managers/file_manager.h"
+#include "ui/change_notification_bus.h"
 #include "ui/main_window.h"
 #include "ui/main_window_operations.h"
 #include "ui/main_window_ui_builder.h"
 #include "ui/statistics_chart_widget.h"
 #include "utils/consts.h"
 
-int MainWindowSelectionHelper::getSelectedEmployeeId(const MainWindow* window) {
-    if (!window || !window->employeeUI.table) return -1;
-
-    if (int rowIndex = window->employeeUI.table->currentRow(); rowIndex >= 0) {
-        if (const QTableWidgetItem* tableItem =
-                window->employeeUI.table->item(rowIndex, 0);
-            tableItem != nullptr) {
-            bool conversionSuccess = false;
-            int employeeId = tableItem->text().toInt(&conversionSuccess);
-            return conversionSuccess ? employeeId : -1;
-        }
+static int selectedEntityId(const QTableView* table) {
+    if (QModelIndex current = table->currentIndex(); current.isValid()) {
+        bool conversionSuccess = false;
+        int id = current.data(EntityTableModel::IdRole).toInt(
+            &conversionSuccess);
+        return conversionSuccess ? id : -1;
     }
     return -1;
 }
 
+int MainWindowSelectionHelper::getSelectedEmployeeId(const MainWindow* window) {
+    if (!window || !window->employeeUI.table) return -1;
+    return selectedEntityId(window->employeeUI.table);
+}
+
 int MainWindowSelectionHelper::getSelectedProjectId(const MainWindow* window) {
     if (!window || !window->projectUI.table) return -1;
-
-    int rowIndex = window->projectUI.table->currentRow();
-    if (rowIndex < 0) return -1;
-
-    const QTableWidgetItem* tableItem =
-        window->projectUI.table->item(rowIndex, 0);
-    if (tableItem == nullptr) return -1;
-
-    bool conversionSuccess = false;
-    int projectId = tableItem->text().toInt(&conversionSuccess);
-    return conversionSuccess ? projectId : -1;
+    return selectedEntityId(window->projectUI.table);
 }
 
 void MainWindowProjectDetailHelper::showProjectDetails(MainWindow* window,
@@ -253,24 +244,26 @@ bool MainWindowValidationHelper::checkDuplicateProjectOnEdit(
 }
 
 void MainWindowValidationHelper::validateAndFixProjectAssignments(
-    MainWindow* window, const Company* company) {
+    MainWindow* window, const Company* company,
+    const std::unordered_set<int>& projectIds) {
     if (!window || !company) return;
 
     bool hasWarnings = false;
     QStringList warningMessages;
-    auto projects = company->getAllProjects();
-
-    for (const auto& project : projects) {
-        if (project.getAllocatedHours() > 0 &&
-            !ProjectHelper::hasAssignedEmployees(company, project.getId())) {
-            auto oldAllocatedHours = project.getAllocatedHours();
-            ProjectHelper::clearProjectAllocatedHoursIfNoEmployees(
-                company, project.getId());
+
+    for (int projectId : projectIds) {
+        const auto* project = company->getProject(projectId);
+        if (project == nullptr) continue;
+        if (project->getAllocatedHours() > 0 &&
+            !ProjectHelper::hasAssignedEmployees(company, projectId)) {
+            auto oldAllocatedHours = project->getAllocatedHours();
+            ProjectHelper::clearProjectAllocatedHoursIfNoEmployees(company,
+                                                                   projectId);
             hasWarnings = true;
             warningMessages.append(
                 QString("Project '%1': Found allocated hours (%2h) but no "
                         "assigned employees. Hours have been cleared.")
-                    .arg(project.getName(),
+                    .arg(project->getName(),
                          QString::number(oldAllocatedHours)));
         }
     }
@@ -474,7 +467,7 @@ void MainWindowProjectDialogHandler::handleEditProjectDialog(
         }
 
         updateProjectWithChanges(window, projectId, data, fields, oldProject);
-        MainWindowDataOperations::refreshAllData(window);
+        MainWindowDataOperations::publishChanges(window);
         MainWindowDataOperations::autoSave(window);
         showProjectUpdateSuccess(dialog, data);
     } catch (const CompanyException& e) {
@@ -521,7 +514,7 @@ void MainWindowProjectDialogHandler::handleAddTaskDialog(
             project->recomputeTotalsFromTasks();
         }
 
-        MainWindowDataOperations::refreshAllData(window);
+        MainWindowDataOperations::publishChanges(window);
         MainWindowDataOperations::autoSave(window);
         QMessageBox::information(
             &dialog, "Success",
@@ -582,14 +575,14 @@ void MainWindowProjectDialogHandler::handleAssignEmployeeToTaskDialog(
 
         window->currentCompany->assignEmployeeToTask(employeeId, projectId,
                                                      taskId, hours);
-        window->currentCompany->recalculateTaskAllocatedHours();
+        window->currentCompany->recalculateChanged();
 
         if (auto* project = window->currentCompany->getProject(projectId);
             project) {
             project->recomputeTotalsFromTasks();
         }
 
-        MainWindowDataOperations::refreshAllData(window);
+        MainWindowDataOperations::publishChanges(window);
         MainWindowDataOperations::autoSave(window);
 
         QString taskName;
@@ -702,6 +695,7 @@ void MainWindowTaskAssignmentHelper::handleEmployeeActiveAssignments(
         employee->addToProjectHistory(projectId);
         employee->removeAssignedProject(projectId);
     }
+    window->currentCompany->markEmployeeChanged(employeeId);
 }
 
 void MainWindowUIHelper::setupUI(MainWindow* window) {
@@ -755,6 +749,14 @@ void MainWindowUIHelper::setupTableWidget(QTableWidget* table,
 
     table->setColumnCount(headers.size());
     table->setHorizontalHeaderLabels(headers);
+    setupTableView(table, columnWidths, stretchLast);
+}
+
+void MainWindowUIHelper::setupTableView(QTableView* table,
+                                        const QList<int>& columnWidths,
+                                        bool stretchLast) {
+    if (!table) return;
+
     table->horizontalHeader()->setVisible(true);
     table->setSelectionBehavior(QAbstractItemView::SelectRows);
     table->setSelectionMode(QAbstractItemView::SingleSelection);
@@ -762,43 +764,36 @@ void MainWindowUIHelper::setupTableWidget(QTableWidget* table,
     table->horizontalHeader()->setStretchLastSection(stretchLast);
     table->setAlternatingRowColors(true);
     table->setStyleSheet(
-        "QTableWidget::item:selected { background-color: #c8c8c8; color: "
+        "QTableView::item:selected { background-color: #c8c8c8; color: "
         "black; }"
-        "QTableWidget::item:selected:active { background-color: #c8c8c8; }"
-        "QTableWidget::item:selected:!active { background-color: #c8c8c8; }");
+        "QTableView::item:selected:active { background-color: #c8c8c8; }"
+        "QTableView::item:selected:!active { background-color: #c8c8c8; }");
     table->setShowGrid(true);
+    table->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
     table->verticalHeader()->setDefaultSectionSize(58);
     table->verticalHeader()->setVisible(false);
 
-    for (int i = 0; i < columnWidths.size() && i < headers.size(); ++i) {
+    int columnCount =
+        table->model() ? table->model()->columnCount() : columnWidths.size();
+    for (int i = 0; i < columnWidths.size() && i < columnCount; ++i) {
         table->setColumnWidth(i, columnWidths[i]);
     }
 }
 
-QWidget* MainWindowUIHelper::createEmployeeActionButtons(MainWindow* window,
-                                                         int rowIndex) {
-    return ActionButtonHelper::createEmployeeActionButtons(
-        window->employeeUI.table, rowIndex, window);
-}
-
-QWidget* MainWindowUIHelper::createProjectActionButtons(MainWindow* window,
-                                                        int rowIndex) {
-    return ActionButtonHelper::createProjectActionButtons(
-        window->projectUI.table, rowIndex, window);
-}
-
 void MainWindowDataOperations::refreshAllData(MainWindow* window) {
     if (!window) return;
 
     if (window->currentCompany != nullptr) {
+        std::unordered_set<int> projectIds;
+        for (const auto& project : window->currentCompany->getProjectsView()) {
+            projectIds.insert(project.getId());
+        }
         MainWindowValidationHelper::validateAndFixProjectAssignments(
-            window, window->currentCompany);
-        window->currentCompany->recalculateTaskAllocatedHours();
+            window, window->currentCompany, projectIds);
+        window->currentCompany->recalculateChanged();
     }
 
-    EmployeeOperations::refreshEmployeeTable(window);
-    ProjectOperations::refreshProjectTable(window);
-    ProjectOperations::showStatistics(window);
+    showCurrentCompany(window);
 
     if (window->projectUI.detailContainer != nullptr &&
         window->projectUI.detailContainer->isVisible() &&
@@ -807,8 +802,66 @@ void MainWindowDataOperations::refreshAllData(MainWindow* window) {
     }
 }
 
+void MainWindowDataOperations::showCurrentCompany(MainWindow* window) {
+    if (!window) return;
+
+    window->changeBus->attach(window->currentCompany);
+    EmployeeOperations::refreshEmployeeTable(window);
+    ProjectOperations::refreshProjectTable(window);
+    ProjectOperations::showStatistics(window);
+}
+
+void MainWindowDataOperations::connectChangeNotifications(MainWindow* window) {
+    auto* bus = window->changeBus;
+    // Projects touched during one flush, handled once it is complete.
+    auto touchedProjects = std::make_shared<std::unordered_set<int>>();
+
+    QObject::connect(bus, &ChangeNotificationBus::employeesChanged, window,
+                     [window](const std::unordered_set<int>& ids) {
+                         window->employeeUI.model->refreshEntities(ids);
+                         window->employeeUI.search->refresh(
+                             window->currentCompany);
+                     });
+    QObject::connect(bus, &ChangeNotificationBus::projectsChanged, window,
+                     [touchedProjects](const std::unordered_set<int>& ids) {
+                         touchedProjects->insert(ids.begin(), ids.end());
+                     });
+    QObject::connect(
+        bus, &ChangeNotificationBus::assignmentsChanged, window,
+        [window, touchedProjects](const std::unordered_set<int>& employeeIds,
+                                  const std::unordered_set<int>& projectIds) {
+            window->employeeUI.model->refreshEntities(employeeIds);
+            touchedProjects->insert(projectIds.begin(), projectIds.end());
+        });
+    QObject::connect(
+        bus, &ChangeNotificationBus::changesPublished, window,
+        [window, touchedProjects]() {
+            auto projectIds = std::exchange(*touchedProjects, {});
+            MainWindowValidationHelper::validateAndFixProjectAssignments(
+                window, window->currentCompany, projectIds);
+            window->projectUI.model->refreshEntities(projectIds);
+            ProjectOperations::showStatistics(window);
+
+            if (window->projectUI.detailContainer != nullptr &&
+                window->projectUI.detailContainer->isVisible() &&
+                projectIds.contains(window->detailedProjectId)) {
+                MainWindowProjectDetailHelper::refreshProjectDetailView(window);
+            }
+        });
+}
+
+void MainWindowDataOperations::publishChanges(MainWindow* window) {
+    if (!window) return;
+    window->changeBus->flush();
+}
+
 void MainWindowDataOperations::autoSave(MainWindow* window) {
     if (!window) return;
+    publishChanges(window);
+    if (window->autoSaver) {
+        window->autoSaver->requestSave();
+        return;
+    }
     AutoSaveLoader::autoSave(window->companies, window);
 }
 
@@ -827,9 +880,7 @@ void MainWindowDataOperations::autoLoad(MainWindow* window) {
         }
     }
 
-    EmployeeOperations::refreshEmployeeTable(window);
-    ProjectOperations::refreshProjectTable(window);
-    ProjectOperations::showStatistics(window);
+    showCurrentCompany(window);
 }
 
 void MainWindowDataOperations::selectProjectRowById(MainWindow* window,
@@ -839,19 +890,13 @@ void MainWindowDataOperations::selectProjectRowById(MainWindow* window,
 
 void MainWindowUIHelper::selectProjectRowById(MainWindow* window,
                                               int projectId) {
-    if (window->projectUI.table == nullptr) return;
+    if (window->projectUI.table == nullptr ||
+        window->projectUI.model == nullptr) {
+        return;
+    }
 
-    int rowCount = window->projectUI.table->rowCount();
-    for (int row = 0; row < rowCount; ++row) {
-        const QTableWidgetItem* item = window->projectUI.table->item(row, 0);
-        if (item == nullptr) {
-            continue;
-        }
-        bool ok = false;
-        int idValue = item->text().toInt(&ok);
-        if (ok && idValue == projectId) {
-            window->projectUI.table->setCurrentCell(row, 0);
-            break;
-        }
+    if (int row = window->projectUI.model->rowOf(projectId); row >= 0) {
+        window->projectUI.table->setCurrentIndex(
+            window->projectUI.model->index(row, 0));
     }
 }
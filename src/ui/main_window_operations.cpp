@@ -37,6 +37,7 @@
 #include "helpers/task_assignment_helper.h"
 #include "helpers/task_dialog_helper.h"
 #include "helpers/validation_helper.h"
+#include "managers/auto_save_loader.h"
 #include "managers/company_manager.h"
 #include "services/cost_calculation_service.h"
 #include "services/task_assignment_service.h"
@@ -55,7 +56,7 @@ static void handleAddEmployeeSuccess(MainWindow* window, QDialog& dialog,
                                      const QLineEdit* nameEdit,
                                      const QComboBox* typeCombo,
                                      const QLineEdit* salaryEdit) {
-    MainWindowDataOperations::refreshAllData(window);
+    MainWindowDataOperations::publishChanges(window);
     MainWindowDataOperations::autoSave(window);
     QMessageBox::information(&dialog, "Success",
                              "Employee added successfully!\n\n"
@@ -93,7 +94,7 @@ static void handleEditEmployeeSuccess(QDialog& dialog,
                                       const QLineEdit* nameEdit,
                                       const QString& currentType,
                                       const QLineEdit* salaryEdit) {
-    MainWindowDataOperations::refreshAllData(
+    MainWindowDataOperations::publishChanges(
         qobject_cast<MainWindow*>(dialog.parent()));
     MainWindowDataOperations::autoSave(
         qobject_cast<MainWindow*>(dialog.parent()));
@@ -211,7 +212,7 @@ static void handleEditEmployeeButtonClick(
             return;
         }
         if (auto* mainWindow = qobject_cast<MainWindow*>(window)) {
-            MainWindowDataOperations::refreshAllData(mainWindow);
+            MainWindowDataOperations::publishChanges(mainWindow);
             MainWindowDataOperations::autoSave(mainWindow);
         }
         QMessageBox::information(&dialog, "Success",
@@ -261,7 +262,7 @@ static void handleAutoAssignCompanyException(MainWindow* window, int projectId,
         int trackedHours = parts.size() > 1 ? parts[1].toInt() : 0;
         int actualHours = parts.size() > 2 ? parts[2].toInt() : 0;
 
-        MainWindowDataOperations::refreshAllData(window);
+        MainWindowDataOperations::publishChanges(window);
         const auto* projectAfter =
             window->currentCompany->getProject(projectId);
         int allocatedAfter =
@@ -633,7 +634,7 @@ void EmployeeOperations::deleteEmployee(MainWindow* window) {
             auto employees = window->currentCompany->getAllEmployees();
             window->nextEmployeeId = IdHelper::calculateNextId(
                 IdHelper::findMaxEmployeeId(employees));
-            MainWindowDataOperations::refreshAllData(window);
+            MainWindowDataOperations::publishChanges(window);
             MainWindowDataOperations::autoSave(window);
             QMessageBox::information(window, "Success",
                                      "Employee deleted successfully!");
@@ -698,7 +699,8 @@ void EmployeeOperations::fireEmployee(MainWindow* window) {
     if (userChoice == QMessageBox::Yes) {
         try {
             employee->setIsActive(false);
-            MainWindowDataOperations::refreshAllData(window);
+            window->currentCompany->markEmployeeChanged(employeeId);
+            MainWindowDataOperations::publishChanges(window);
             MainWindowDataOperations::autoSave(window);
             QMessageBox::information(
                 window, "Success",
@@ -723,59 +725,14 @@ void EmployeeOperations::searchEmployee(MainWindow* window) {
         return;
 
     auto searchTerm = window->employeeUI.searchEdit->text().trimmed().toLower();
-
-    if (searchTerm.isEmpty()) {
-        DisplayHelper::displayEmployees(window->employeeUI.table,
-                                        window->currentCompany, window);
-        return;
-    }
-
-    auto employees = window->currentCompany->getAllEmployees();
-    window->employeeUI.table->setRowCount(0);
-    int rowIndex = 0;
-
-    for (const auto& employee : employees) {
-        if (!employee) continue;
-
-        auto name = employee->getName().toLower();
-        auto department = employee->getDepartment().toLower();
-        auto position = employee->getPosition().toLower();
-
-        if (name.contains(searchTerm) || department.contains(searchTerm) ||
-            position.contains(searchTerm)) {
-            window->employeeUI.table->insertRow(rowIndex);
-            window->employeeUI.table->setItem(
-                rowIndex, 0,
-                new QTableWidgetItem(QString::number(employee->getId())));
-            window->employeeUI.table->setItem(
-                rowIndex, 1, new QTableWidgetItem(employee->getName()));
-            window->employeeUI.table->setItem(
-                rowIndex, 2, new QTableWidgetItem(employee->getDepartment()));
-            window->employeeUI.table->setItem(
-                rowIndex, 3,
-                new QTableWidgetItem(
-                    QString::number(employee->getSalary(), 'f', 2)));
-            window->employeeUI.table->setItem(
-                rowIndex, 4, new QTableWidgetItem(employee->getEmployeeType()));
-
-            QString projectInfo = DisplayHelper::formatProjectInfo(
-                employee, window->currentCompany);
-            window->employeeUI.table->setItem(
-                rowIndex, 5, new QTableWidgetItem(projectInfo));
-
-            window->employeeUI.table->setCellWidget(
-                rowIndex, 6,
-                MainWindowUIHelper::createEmployeeActionButtons(window,
-                                                                rowIndex));
-            rowIndex++;
-        }
-    }
+    window->employeeUI.search->requestSearch(window->currentCompany,
+                                             searchTerm);
 }
 
 void EmployeeOperations::refreshEmployeeTable(MainWindow* window) {
-    if (!window) return;
-    DisplayHelper::displayEmployees(window->employeeUI.table,
-                                    window->currentCompany, window);
+    if (!window || !window->employeeUI.model) return;
+    window->employeeUI.model->setCompany(window->currentCompany);
+    window->employeeUI.search->refresh(window->currentCompany);
 }
 
 void ProjectOperations::addProject(MainWindow* window) {
@@ -865,7 +822,7 @@ void ProjectOperations::deleteProject(MainWindow* window) {
             auto projects = window->currentCompany->getAllProjects();
             window->nextProjectId =
                 IdHelper::calculateNextId(IdHelper::findMaxProjectId(projects));
-            MainWindowDataOperations::refreshAllData(window);
+            MainWindowDataOperations::publishChanges(window);
             MainWindowDataOperations::autoSave(window);
             if (window->detailedProjectId == projectId) {
                 ProjectDetailOperations::hideProjectDetails(window);
@@ -885,9 +842,8 @@ void ProjectOperations::deleteProject(MainWindow* window) {
 }
 
 void ProjectOperations::refreshProjectTable(MainWindow* window) {
-    if (!window) return;
-    DisplayHelper::displayProjects(window->projectUI.table,
-                                   window->currentCompany, window);
+    if (!window || !window->projectUI.model) return;
+    window->projectUI.model->setCompany(window->currentCompany);
 }
 
 void ProjectOperations::openProjectDetails(MainWindow* window) {
@@ -1305,7 +1261,7 @@ static void executeAutoAssignAndShowResult(MainWindow* window, int projectId,
     auto allocatedBefore = project->getAllocatedHours();
 
     window->currentCompany->autoAssignEmployeesToProject(projectId);
-    MainWindowDataOperations::refreshAllData(window);
+    MainWindowDataOperations::publishChanges(window);
 
     MainWindowDataOperations::selectProjectRowById(window, projectId);
 
@@ -1369,6 +1325,95 @@ void ProjectOperations::autoAssignToProject(MainWindow* window, int projectId) {
     }
 }
 
+static bool selectAutoAssignOptions(MainWindow* window, AutoAssignOrder& order,
+                                    AutoAssignSolver& solver) {
+    QDialog dialog(window);
+    dialog.setWindowTitle("Auto Assign All Projects");
+    dialog.setMinimumWidth(kDefaultDialogMinWidth);
+    dialog.setStyleSheet(
+        "QDialog { background-color: white; } "
+        "QComboBox { background-color: white; color: black; } "
+        "QLabel { color: black; }");
+
+    auto* form = new QFormLayout(&dialog);
+    form->addRow(new QLabel(
+        "Automatically assign available employees to every project that is "
+        "not completed?"));
+
+    auto* orderCombo = new QComboBox();
+    orderCombo->addItem("Highest task priority first",
+                        static_cast<int>(AutoAssignOrder::Priority));
+    orderCombo->addItem("Earliest deadline first",
+                        static_cast<int>(AutoAssignOrder::Deadline));
+    orderCombo->addItem("Largest budget first",
+                        static_cast<int>(AutoAssignOrder::Budget));
+    form->addRow("Order:", orderCombo);
+
+    auto* solverCombo = new QComboBox();
+    solverCombo->addItem("Fast (cheapest employees first)",
+                         static_cast<int>(AutoAssignSolver::Greedy));
+    solverCombo->addItem("Optimal (most hours within budget)",
+                         static_cast<int>(AutoAssignSolver::MinCostFlow));
+    form->addRow("Method:", solverCombo);
+
+    auto* runButton = new QPushButton("Auto Assign");
+    form->addRow(runButton);
+    QObject::connect(runButton, &QPushButton::clicked, &dialog,
+                     &QDialog::accept);
+
+    if (dialog.exec() != QDialog::Accepted) return false;
+    order = static_cast<AutoAssignOrder>(orderCombo->currentData().toInt());
+    solver = static_cast<AutoAssignSolver>(solverCombo->currentData().toInt());
+    return true;
+}
+
+static QString buildAutoAssignSummaryMessage(const Company* company,
+                                             const AutoAssignSummary& summary) {
+    QString message = QString("Hours assigned: %1h across %2 projects\n")
+                          .arg(summary.totalHours)
+                          .arg(summary.hoursByProject.size());
+    for (const auto& [projectId, hours] : summary.hoursByProject) {
+        const auto* project = company->getProject(projectId);
+        message += QString("\n%1: %2h")
+                       .arg(project ? project->getName()
+                                    : QString::number(projectId))
+                       .arg(hours);
+    }
+    return message;
+}
+
+void ProjectOperations::autoAssignAllProjects(MainWindow* window) {
+    if (!MainWindowValidationHelper::checkCompanyAndHandleError(
+            window, "auto-assigning employees"))
+        return;
+
+    AutoAssignOrder order = AutoAssignOrder::Priority;
+    AutoAssignSolver solver = AutoAssignSolver::Greedy;
+    if (!selectAutoAssignOptions(window, order, solver)) {
+        return;
+    }
+
+    try {
+        auto summary =
+            window->currentCompany->autoAssignAllProjects(order, solver);
+        MainWindowDataOperations::publishChanges(window);
+        MainWindowDataOperations::autoSave(window);
+        QMessageBox::information(
+            window, "Auto Assign All",
+            buildAutoAssignSummaryMessage(window->currentCompany, summary));
+    } catch (const CompanyException& e) {
+        handleAutoAssignGenericException(window, e);
+    } catch (const EmployeeException& e) {
+        handleAutoAssignGenericException(window, e);
+    } catch (const ProjectException& e) {
+        handleAutoAssignGenericException(window, e);
+    } catch (const TaskException& e) {
+        handleAutoAssignGenericException(window, e);
+    } catch (const FileManagerException& e) {
+        handleAutoAssignGenericException(window, e);
+    }
+}
+
 void ProjectOperations::viewProjectAssignments(MainWindow* window) {
     if (!MainWindowValidationHelper::checkCompanyAndHandleError(
             window, "viewing project assignments"))
@@ -1633,13 +1678,21 @@ void CompanyOperations::addCompany(MainWindow* window) {
                                window->currentCompanyIndex,
                                window->companyUI.selector, window);
     CompanyOperations::refreshCompanyList(window);
-    EmployeeOperations::refreshEmployeeTable(window);
     ProjectDetailOperations::hideProjectDetails(window);
-    ProjectOperations::refreshProjectTable(window);
-    ProjectOperations::showStatistics(window);
+    MainWindowDataOperations::showCurrentCompany(window);
     MainWindowDataOperations::autoSave(window);
 }
 
+static void ensureCurrentCompanyLoaded(MainWindow* window) {
+    try {
+        AutoSaveLoader::ensureLoaded(window->currentCompany, window);
+    } catch (const FileManagerException& e) {
+        QMessageBox::warning(
+            window, "Load Error",
+            QString("Failed to load company data: %1").arg(e.what()));
+    }
+}
+
 void CompanyOperations::switchCompany(MainWindow* window) {
     if (!window) return;
     if (window->companyUI.selector != nullptr) {
@@ -1647,10 +1700,9 @@ void CompanyOperations::switchCompany(MainWindow* window) {
         CompanyManager::switchCompany(window->companies, window->currentCompany,
                                       window->currentCompanyIndex,
                                       window->companyUI.selector, newIndex);
-        EmployeeOperations::refreshEmployeeTable(window);
+        ensureCurrentCompanyLoaded(window);
         ProjectDetailOperations::hideProjectDetails(window);
-        ProjectOperations::refreshProjectTable(window);
-        ProjectOperations::showStatistics(window);
+        MainWindowDataOperations::showCurrentCompany(window);
 
         if (window->currentCompany != nullptr) {
             auto employees = window->currentCompany->getAllEmployees();
@@ -1666,14 +1718,17 @@ void CompanyOperations::switchCompany(MainWindow* window) {
 
 void CompanyOperations::deleteCompany(MainWindow* window) {
     if (!window) return;
+    size_t companyCount = window->companies.size();
     CompanyManager::deleteCompany(window->companies, window->currentCompany,
                                   window->currentCompanyIndex,
                                   window->companyUI.selector, window);
+    if (window->companies.size() < companyCount) {
+        // The next save renumbers the files, so every company is read now.
+        AutoSaveLoader::ensureAllLoaded(window->companies, window);
+    }
     CompanyOperations::refreshCompanyList(window);
-    EmployeeOperations::refreshEmployeeTable(window);
     ProjectDetailOperations::hideProjectDetails(window);
-    ProjectOperations::refreshProjectTable(window);
-    ProjectOperations::showStatistics(window);
+    MainWindowDataOperations::showCurrentCompany(window);
     MainWindowDataOperations::autoSave(window);
 }
 
@@ -1687,10 +1742,8 @@ void CompanyOperations::refreshCompanyList(MainWindow* window) {
 void CompanyOperations::initializeCompanySetup(MainWindow* window) {
     if (!window) return;
 
-    EmployeeOperations::refreshEmployeeTable(window);
     ProjectDetailOperations::hideProjectDetails(window);
-    ProjectOperations::refreshProjectTable(window);
-    ProjectOperations::showStatistics(window);
+    MainWindowDataOperations::showCurrentCompany(window);
 
     if (window->currentCompany != nullptr) {
         auto employees = window->currentCompany->getAllEmployees();
@@ -10,11 +10,13 @@
 #include <QPushButton>
 #include <QSizePolicy>
 #include <QTabWidget>
+#include <QTableView>
 #include <QTableWidget>
 #include <QTextEdit>
 #include <QVBoxLayout>
 #include <QWidget>
 
+#include "helpers/action_button_helper.h"
 #include "ui/main_window.h"
 #include "ui/main_window_helpers.h"
 #include "ui/main_window_operations.h"
@@ -103,12 +105,17 @@ void MainWindowUIBuilder::setupEmployeeTab(MainWindow* window,
 
     mainLayout->addLayout(toolbarLayout);
 
-    window->employeeUI.table = new QTableWidget();
-    auto headers = QStringList{"ID",   "Name",    "Department", "Salary",
-                               "Type", "Project", "Actions"};
+    window->employeeUI.table = new QTableView();
+    window->employeeUI.model = new EmployeeTableModel(window->employeeUI.table);
+    window->employeeUI.proxy = new EntityFilterProxyModel(
+        window->employeeUI.model, window->employeeUI.table);
+    window->employeeUI.search = new EmployeeSearchController(
+        window->employeeUI.proxy, window->employeeUI.table);
+    window->employeeUI.table->setModel(window->employeeUI.proxy);
     auto columnWidths = QList<int>{110, 280, 250, 210, 250, 590, 10};
-    MainWindowUIHelper::setupTableWidget(window->employeeUI.table, headers,
-                                         columnWidths);
+    MainWindowUIHelper::setupTableView(window->employeeUI.table, columnWidths);
+    ActionButtonHelper::installEmployeeActions(window->employeeUI.table,
+                                               window);
 
     mainLayout->addWidget(window->employeeUI.table);
 
@@ -136,18 +143,22 @@ void MainWindowUIBuilder::setupProjectTab(MainWindow* window,
     actionsLayout->setContentsMargins(0, 0, 0, 0);
     actionsLayout->addStretch();
 
+    window->projectUI.autoAssignAllBtn = new QPushButton("Auto Assign All");
+    window->projectUI.autoAssignAllBtn->setMinimumWidth(160);
+    window->projectUI.autoAssignAllBtn->setMinimumHeight(42);
+    actionsLayout->addWidget(window->projectUI.autoAssignAllBtn);
+
     window->projectUI.addBtn = new QPushButton("➕ Add Project");
     window->projectUI.addBtn->setMinimumWidth(160);
     window->projectUI.addBtn->setMinimumHeight(42);
     actionsLayout->addWidget(window->projectUI.addBtn);
 
-    window->projectUI.table = new QTableWidget();
-    auto headers =
-        QStringList{"ID",         "Name",         "Phase",  "Budget",
-                    "Est. Hours", "Alloc. Hours", "Client", "Actions"};
+    window->projectUI.table = new QTableView();
+    window->projectUI.model = new ProjectTableModel(window->projectUI.table);
+    window->projectUI.table->setModel(window->projectUI.model);
     auto columnWidths = QList<int>{110, 340, 240, 220, 240, 240, 300, 100};
-    MainWindowUIHelper::setupTableWidget(window->projectUI.table, headers,
-                                         columnWidths);
+    MainWindowUIHelper::setupTableView(window->projectUI.table, columnWidths);
+    ActionButtonHelper::installProjectActions(window->projectUI.table, window);
 
     window->projectUI.listContainer = new QWidget();
     auto* projectListLayout = new QVBoxLayout(window->projectUI.listContainer);
@@ -228,6 +239,9 @@ void MainWindowUIBuilder::setupProjectTab(MainWindow* window,
 
     QObject::connect(window->projectUI.addBtn, &QPushButton::clicked,
                      [window]() { ProjectOperations::addProject(window); });
+    QObject::connect(
+        window->projectUI.autoAssignAllBtn, &QPushButton::clicked,
+        [window]() { ProjectOperations::autoAssignAllProjects(window); });
     QObject::connect(
         window->projectUI.detailCloseBtn, &QPushButton::clicked,
         [window]() { ProjectOperations::closeProjectDetails(window); });
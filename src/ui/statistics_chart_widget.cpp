@@ -1,11 +1,13 @@
 #include "ui/statistics_chart_widget.h"
 
+#include <QBrush>
 #include <QColor>
 #include <QFont>
 #include <QLinearGradient>
 #include <QPaintEvent>
 #include <QPainter>
 #include <QPen>
+#include <QRect>
 #include <QTimer>
 #include <algorithm>
 #include <map>
@@ -14,6 +16,46 @@
 #include "entities/company.h"
 #include "entities/employee.h"
 
+static constexpr int kChartPadding = 60;
+static constexpr int kChartHeaderHeight = 50;
+static constexpr int kBarSpacing = 8;
+static constexpr int kMinBarWidth = 20;
+static constexpr int kMaxBarWidth = 80;
+
+struct ChartArea {
+    int x;
+    int y;
+    int width;
+    int height;
+
+    int baseY() const { return y + height; }
+    int maxBarHeight() const { return height - 30; }
+};
+
+static ChartArea chartAreaFor(int width, int height) {
+    return {kChartPadding, kChartPadding + kChartHeaderHeight,
+            width - kChartPadding * 2,
+            height - kChartPadding * 2 - kChartHeaderHeight};
+}
+
+static const std::map<QString, QColor>& fixedTypeColors() {
+    static const std::map<QString, QColor> colors = {
+        {"Developer", QColor(33, 150, 243)},
+        {"Manager", QColor(76, 175, 80)},
+        {"Designer", QColor(255, 152, 0)},
+        {"QA", QColor(156, 39, 176)},
+    };
+    return colors;
+}
+
+static QColor colorForType(const QString& employeeType) {
+    const auto& colors = fixedTypeColors();
+    if (auto it = colors.find(employeeType); it != colors.end()) {
+        return it->second;
+    }
+    return QColor(128, 128, 128);
+}
+
 StatisticsChartWidget::StatisticsChartWidget(QWidget* parent)
     : QWidget(parent) {
     animationTimer = new QTimer(this);
@@ -28,19 +70,140 @@ StatisticsChartWidget::StatisticsChartWidget(QWidget* parent)
 }
 
 void StatisticsChartWidget::setData(const Company* companyData) {
-    this->company = companyData;
+    if (companyData != company ||
+        (companyData && companyData->getModelVersion() != dataVersion)) {
+        this->company = companyData;
+        rebuildChartData();
+    }
     animationProgress = 0.0;
     animationTimer->start(16);
     update();
 }
 
+void StatisticsChartWidget::rebuildChartData() {
+    salaries.clear();
+    hasEmployees = false;
+    totalSalaries = 0.0;
+    maxSalary = 1.0;
+    dataVersion = company ? company->getModelVersion() : 0;
+    layoutSize = QSize();
+    if (company == nullptr) return;
+
+    auto employees = company->getEmployeesView();
+    hasEmployees = !employees.empty();
+    salaries.reserve(employees.size());
+    for (const auto& emp : employees) {
+        if (emp && emp->getIsActive()) {
+            salaries.push_back({emp->getId(), emp->getName(),
+                                emp->getEmployeeType(), emp->getSalary()});
+        }
+    }
+    std::ranges::sort(salaries, {}, &SalaryEntry::salary);
+
+    totalSalaries = company->getTotalSalaries();
+    if (!salaries.empty() && salaries.back().salary > 0) {
+        maxSalary = salaries.back().salary;
+    }
+}
+
+static QString shortenedName(const QString& name) {
+    return name.length() > 12 ? name.left(10) + ".." : name;
+}
+
+StatisticsChartWidget::Bar StatisticsChartWidget::employeeBar(
+    const SalaryEntry& entry, int x) {
+    return {x, entry.salary, colorForType(entry.employeeType),
+            shortenedName(entry.name),
+            "#" + QString::number(entry.employeeId)};
+}
+
+StatisticsChartWidget::Bar StatisticsChartWidget::mergedBar(size_t first,
+                                                           size_t last,
+                                                           int x) const {
+    double sum = 0.0;
+    std::map<QString, size_t> typeCounts;
+    for (size_t i = first; i < last; ++i) {
+        sum += salaries[i].salary;
+        ++typeCounts[salaries[i].employeeType];
+    }
+    auto dominant = std::ranges::max_element(
+        typeCounts, {}, [](const auto& entry) { return entry.second; });
+    return {x, sum / static_cast<double>(last - first),
+            colorForType(dominant->first),
+            QString("%1 emp.").arg(last - first), QString()};
+}
+
+void StatisticsChartWidget::rebuildLayout() {
+    layoutSize = size();
+    bars.clear();
+
+    ChartArea area = chartAreaFor(width(), height());
+    int availableWidth = std::max(area.width - 20, 1);
+    int left = area.x + 10;
+    size_t count = salaries.size();
+    auto pixels = static_cast<size_t>(availableWidth);
+
+    if (count <= pixels) {
+        auto barCount = static_cast<int>(std::max<size_t>(count, 1));
+        int fittedWidth =
+            (availableWidth - kBarSpacing * (barCount - 1)) / barCount;
+        bars.reserve(count);
+        if (fittedWidth >= kMinBarWidth) {
+            barWidth = std::min(fittedWidth, kMaxBarWidth);
+            for (size_t i = 0; i < count; ++i) {
+                bars.push_back(employeeBar(
+                    salaries[i],
+                    left + static_cast<int>(i) * (barWidth + kBarSpacing)));
+            }
+        } else {
+            // Too narrow for labels and gaps: the bars share the width
+            // evenly, down to one pixel each.
+            int step = availableWidth / barCount;
+            barWidth = std::max(step > 3 ? step - 1 : step, 1);
+            for (size_t i = 0; i < count; ++i) {
+                bars.push_back(employeeBar(
+                    salaries[i], left + static_cast<int>(i * pixels / count)));
+            }
+        }
+    } else {
+        // More employees than pixels: each pixel column shows the mean of a
+        // run of neighbouring salaries.
+        barWidth = 1;
+        bars.reserve(pixels);
+        for (size_t column = 0; column < pixels; ++column) {
+            bars.push_back(mergedBar(column * count / pixels,
+                                     (column + 1) * count / pixels,
+                                     left + static_cast<int>(column)));
+        }
+    }
+
+    qreal pixelRatio = devicePixelRatioF();
+    staticLayer = QPixmap(size() * pixelRatio);
+    staticLayer.setDevicePixelRatio(pixelRatio);
+    QPainter layerPainter(&staticLayer);
+    layerPainter.setRenderHint(QPainter::Antialiasing);
+    paintStaticLayer(layerPainter);
+}
+
 void StatisticsChartWidget::paintEvent(QPaintEvent* event) {
     (void)event;
     if (company == nullptr) return;
 
+    if (layoutSize != size() ||
+        staticLayer.devicePixelRatio() != devicePixelRatioF()) {
+        rebuildLayout();
+    }
+
     QPainter painter(this);
+    painter.drawPixmap(0, 0, staticLayer);
+    if (salaries.empty()) return;
+
     painter.setRenderHint(QPainter::Antialiasing);
+    drawBars(painter, animationProgress);
+    drawLegend(painter);
+}
 
+void StatisticsChartWidget::paintStaticLayer(QPainter& painter) const {
     int width = this->width();
     int height = this->height();
 
@@ -50,49 +213,16 @@ void StatisticsChartWidget::paintEvent(QPaintEvent* event) {
     bgGradient.setColorAt(1, QColor(255, 255, 255));
     painter.fillRect(0, 0, width, height, bgGradient);
 
-    auto employees = company->getAllEmployees();
-
-    if (employees.empty()) {
-        painter.setPen(QPen(QColor(150, 150, 150), 1));
-        painter.setFont(QFont("Segoe UI", 16));
-        painter.drawText(0, 0, width, height, Qt::AlignCenter,
-                         "No employees data available");
-        return;
-    }
-
-    std::vector<std::pair<std::shared_ptr<Employee>, double>> employeeData;
-    for (const auto& emp : employees) {
-        if (emp && emp->getIsActive()) {
-            employeeData.emplace_back(emp, emp->getSalary());
-        }
-    }
-
-    std::ranges::sort(employeeData, [](const auto& a, const auto& b) {
-        return a.second < b.second;
-    });
-
-    if (employeeData.empty()) {
+    if (salaries.empty()) {
         painter.setPen(QPen(QColor(150, 150, 150), 1));
         painter.setFont(QFont("Segoe UI", 16));
         painter.drawText(0, 0, width, height, Qt::AlignCenter,
-                         "No active employees");
+                         hasEmployees ? "No active employees"
+                                      : "No employees data available");
         return;
     }
 
-    drawMainEmployeeSalaryChart(painter, width, height, employeeData,
-                                animationProgress);
-}
-
-void StatisticsChartWidget::drawMainEmployeeSalaryChart(
-    QPainter& painter, int width, int height,
-    const std::vector<std::pair<std::shared_ptr<Employee>, double>>&
-        employeeData,
-    double progress) const {
-    int padding = 60;
-    int chartX = padding;
-    int chartY = padding + 50;
-    int chartWidth = width - padding * 2;
-    int chartHeight = height - padding * 2 - 50;
+    ChartArea area = chartAreaFor(width, height);
 
     painter.setPen(QPen(QColor(33, 33, 33), 2));
     painter.setFont(QFont("Segoe UI", 20, QFont::Bold));
@@ -102,123 +232,108 @@ void StatisticsChartWidget::drawMainEmployeeSalaryChart(
     painter.setPen(QPen(QColor(100, 100, 100), 1));
     painter.setFont(QFont("Segoe UI", 11));
     QString subtitle = QString("Total Employees: %1 | Total Salary: $%2")
-                           .arg(employeeData.size())
-                           .arg(company->getTotalSalaries(), 0, 'f', 2);
+                           .arg(salaries.size())
+                           .arg(totalSalaries, 0, 'f', 2);
     painter.drawText(0, 50, width, 30, Qt::AlignCenter, subtitle);
 
-    double maxSalary = 0;
-    for (const auto& [emp, salary] : employeeData) {
-        if (salary > maxSalary) maxSalary = salary;
-    }
-    if (maxSalary == 0) maxSalary = 1;
-
     painter.setPen(QPen(QColor(230, 230, 230), 1));
     painter.setFont(QFont("Segoe UI", 9));
     int gridLines = 5;
     for (int i = 0; i <= gridLines; i++) {
         double value = maxSalary * (1.0 - static_cast<double>(i) / gridLines);
-        int y = chartY + static_cast<int>((static_cast<double>(i) / gridLines) *
-                                          chartHeight);
-        painter.drawLine(chartX - 10, y, chartX + chartWidth, y);
+        int y = area.y + static_cast<int>((static_cast<double>(i) / gridLines) *
+                                          area.height);
+        painter.drawLine(area.x - 10, y, area.x + area.width, y);
 
         painter.setPen(QPen(QColor(120, 120, 120), 1));
-        painter.drawText(0, y - 10, chartX - 15, 20,
+        painter.drawText(0, y - 10, area.x - 15, 20,
                          Qt::AlignRight | Qt::AlignVCenter,
                          "$" + QString::number(value, 'f', 0));
         painter.setPen(QPen(QColor(230, 230, 230), 1));
     }
 
     painter.setPen(QPen(QColor(200, 200, 200), 2));
-    painter.drawLine(chartX, chartY, chartX, chartY + chartHeight);
-
-    painter.drawLine(chartX, chartY + chartHeight, chartX + chartWidth,
-                     chartY + chartHeight);
-
-    auto barCount = static_cast<int>(employeeData.size());
-    int barSpacing = 8;
-    int availableWidth = chartWidth - 20;
-    int minBarWidth = 20;
-    int maxBarWidth = 80;
-    int barWidth = qBound(
-        minBarWidth, (availableWidth - barSpacing * (barCount - 1)) / barCount,
-        maxBarWidth);
-    int baseY = chartY + chartHeight;
-
-    std::map<QString, QColor> fixedTypeColors = {
-        {"Developer", QColor(33, 150, 243)},
-        {"Manager", QColor(76, 175, 80)},
-        {"Designer", QColor(255, 152, 0)},
-        {"QA", QColor(156, 39, 176)},
-    };
+    painter.drawLine(area.x, area.y, area.x, area.baseY());
+    painter.drawLine(area.x, area.baseY(), area.x + area.width, area.baseY());
 
-    auto defaultColor = QColor(128, 128, 128);
+    if (barWidth < kMinBarWidth) return;
 
-    int currentX = chartX + 10;
-
-    for (const auto& [emp, salary] : employeeData) {
-        QString empType = emp->getEmployeeType();
+    int baseY = area.baseY();
+    for (const auto& bar : bars) {
+        painter.setPen(QPen(QColor(66, 66, 66), 1));
+        painter.setFont(QFont("Segoe UI", 8));
+        QRect nameRect(bar.x, baseY + 5, barWidth, 20);
+        painter.drawText(nameRect, Qt::AlignCenter | Qt::TextWordWrap,
+                         bar.name);
+
+        if (!bar.caption.isEmpty()) {
+            painter.setPen(QPen(QColor(150, 150, 150), 1));
+            painter.setFont(QFont("Segoe UI", 7));
+            painter.drawText(bar.x, baseY + 25, barWidth, 15, Qt::AlignCenter,
+                             bar.caption);
+        }
+    }
+}
 
-        QColor baseColor = defaultColor;
-        if (auto it = fixedTypeColors.find(empType);
-            it != fixedTypeColors.end()) {
-            baseColor = it->second;
+void StatisticsChartWidget::drawBars(QPainter& painter, double progress) const {
+    ChartArea area = chartAreaFor(width(), height());
+    int baseY = area.baseY();
+    QFont salaryFont("Segoe UI", 9, QFont::Bold);
+
+    if (barWidth < kMinBarWidth) {
+        // Plain columns: outlines, shadows and salary captions would cover
+        // the neighbouring bars.
+        for (const auto& bar : bars) {
+            auto targetBarHeight = static_cast<int>(
+                bar.salary / maxSalary * area.maxBarHeight() * progress);
+            painter.fillRect(bar.x, baseY - targetBarHeight, barWidth,
+                             targetBarHeight, bar.color);
         }
+        return;
+    }
 
-        double normalizedSalary = salary / maxSalary;
-        int maxBarHeight = chartHeight - 30;
-        auto targetBarHeight =
-            static_cast<int>(normalizedSalary * maxBarHeight * progress);
+    for (const auto& bar : bars) {
+        double normalizedSalary = bar.salary / maxSalary;
+        auto targetBarHeight = static_cast<int>(
+            normalizedSalary * area.maxBarHeight() * progress);
 
-        QLinearGradient gradient(currentX, baseY - targetBarHeight,
-                                 currentX + barWidth, baseY);
-        gradient.setColorAt(0, baseColor.lighter(130));
-        gradient.setColorAt(0.5, baseColor);
-        gradient.setColorAt(1, baseColor.darker(120));
+        QLinearGradient gradient(bar.x, baseY - targetBarHeight,
+                                 bar.x + barWidth, baseY);
+        gradient.setColorAt(0, bar.color.lighter(130));
+        gradient.setColorAt(0.5, bar.color);
+        gradient.setColorAt(1, bar.color.darker(120));
 
         painter.setPen(Qt::NoPen);
         painter.setBrush(QBrush(QColor(0, 0, 0, 40)));
-        painter.drawRoundedRect(currentX + 3, baseY - targetBarHeight + 3,
+        painter.drawRoundedRect(bar.x + 3, baseY - targetBarHeight + 3,
                                 barWidth, targetBarHeight, 6, 6);
 
         painter.setBrush(QBrush(gradient));
-        painter.setPen(QPen(baseColor.darker(150), 1.5));
-        painter.drawRoundedRect(currentX, baseY - targetBarHeight, barWidth,
+        painter.setPen(QPen(bar.color.darker(150), 1.5));
+        painter.drawRoundedRect(bar.x, baseY - targetBarHeight, barWidth,
                                 targetBarHeight, 6, 6);
 
         if (targetBarHeight > 25) {
             painter.setPen(QPen(QColor(255, 255, 255), 1));
-            painter.setFont(QFont("Segoe UI", 9, QFont::Bold));
-            QString salaryText = "$" + QString::number(salary, 'f', 0);
-            painter.drawText(currentX, baseY - targetBarHeight - 18, barWidth,
-                             16, Qt::AlignCenter, salaryText);
-        }
-
-        painter.setPen(QPen(QColor(66, 66, 66), 1));
-        painter.setFont(QFont("Segoe UI", 8));
-        QString name = emp->getName();
-        if (name.length() > 12) {
-            name = name.left(10) + "..";
+            painter.setFont(salaryFont);
+            painter.drawText(bar.x, baseY - targetBarHeight - 18, barWidth, 16,
+                             Qt::AlignCenter,
+                             "$" + QString::number(bar.salary, 'f', 0));
         }
-        QRect nameRect(currentX, baseY + 5, barWidth, 20);
-        painter.drawText(nameRect, Qt::AlignCenter | Qt::TextWordWrap, name);
-
-        painter.setPen(QPen(QColor(150, 150, 150), 1));
-        painter.setFont(QFont("Segoe UI", 7));
-        painter.drawText(currentX, baseY + 25, barWidth, 15, Qt::AlignCenter,
-                         "#" + QString::number(emp->getId()));
-
-        currentX += barWidth + barSpacing;
     }
+}
 
-    int legendX = chartX + chartWidth - 150;
-    int legendY = chartY + 20;
+void StatisticsChartWidget::drawLegend(QPainter& painter) const {
+    ChartArea area = chartAreaFor(width(), height());
+    int legendX = area.x + area.width - 150;
+    int legendY = area.y + 20;
     painter.setPen(QPen(QColor(33, 33, 33), 1));
     painter.setFont(QFont("Segoe UI", 10, QFont::Bold));
     painter.drawText(legendX, legendY, 150, 20, Qt::AlignLeft,
                      "Employee Types:");
 
     legendY += 25;
-    for (const auto& [type, color] : fixedTypeColors) {
+    for (const auto& [type, color] : fixedTypeColors()) {
         painter.setBrush(QBrush(color));
         painter.setPen(QPen(color.darker(130), 1));
         painter.drawRect(legendX, legendY, 15, 15);
@@ -65,7 +65,7 @@ QString UIStyleHelper::getMainWindowStylesheet() {
             border: 2px solid #0066cc;
             background-color: #ffffff;
         }
-        QTableWidget {
+        QTableView {
             background-color: #ffffff;
             alternate-background-color: #fafafa;
             border: 1px solid #e0e0e0;
@@ -74,16 +74,16 @@ QString UIStyleHelper::getMainWindowStylesheet() {
             selection-background-color: #0066cc;
             selection-color: white;
         }
-        QTableWidget::item {
+        QTableView::item {
             padding: 12px;
             color: #1a1a1a;
             border: none;
         }
-        QTableWidget::item:selected {
+        QTableView::item:selected {
             background-color: #0066cc;
             color: white;
         }
-        QTableWidget::item:hover:!selected {
+        QTableView::item:hover:!selected {
             background-color: #f0f0f0;
         }
         QHeaderView::section {
@@ -182,6 +182,7 @@ QString UIStyleHelper::getMainWindowStylesheet() {
             border: none;
         }
         QCalendarWidget QTableView::item {
+            padding: 0px;
             color: #1a1a1a;
             background-color: transparent;
         }
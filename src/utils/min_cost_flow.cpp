@@ -0,0 +1,97 @@
+#include "utils/min_cost_flow.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <utility>
+
+static constexpr std::int64_t kUnreachable =
+    std::numeric_limits<std::int64_t>::max();
+
+MinCostFlow::MinCostFlow(int nodeCount) : adjacency(nodeCount) {}
+
+int MinCostFlow::addEdge(int from, int to, int capacity, std::int64_t cost) {
+    int edgeId = static_cast<int>(edges.size());
+    edges.push_back({to, capacity, cost});
+    initialCapacity.push_back(capacity);
+    adjacency[from].push_back(edgeId);
+
+    edges.push_back({from, 0, -cost});
+    initialCapacity.push_back(0);
+    adjacency[to].push_back(edgeId + 1);
+    return edgeId;
+}
+
+bool MinCostFlow::findShortestPath(int source, int sink,
+                                   std::vector<std::int64_t>& potential,
+                                   std::vector<int>& parentEdge) const {
+    using QueueEntry = std::pair<std::int64_t, int>;
+    std::vector<std::int64_t> distance(adjacency.size(), kUnreachable);
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>,
+                        std::greater<QueueEntry>>
+        queue;
+
+    std::ranges::fill(parentEdge, -1);
+    distance[source] = 0;
+    queue.emplace(0, source);
+    while (!queue.empty()) {
+        auto [nodeDistance, node] = queue.top();
+        queue.pop();
+        if (nodeDistance > distance[node]) continue;
+
+        for (int edgeId : adjacency[node]) {
+            const Edge& edge = edges[edgeId];
+            if (edge.capacity <= 0) continue;
+            std::int64_t candidate =
+                nodeDistance + edge.cost + potential[node] - potential[edge.to];
+            if (candidate < distance[edge.to]) {
+                distance[edge.to] = candidate;
+                parentEdge[edge.to] = edgeId;
+                queue.emplace(candidate, edge.to);
+            }
+        }
+    }
+
+    if (distance[sink] == kUnreachable) return false;
+    for (size_t node = 0; node < adjacency.size(); ++node) {
+        if (distance[node] != kUnreachable) potential[node] += distance[node];
+    }
+    return true;
+}
+
+MinCostFlow::Result MinCostFlow::solve(int source, int sink,
+                                       std::int64_t costLimit) {
+    Result result;
+    std::vector<std::int64_t> potential(adjacency.size(), 0);
+    std::vector<int> parentEdge(adjacency.size(), -1);
+
+    while (findShortestPath(source, sink, potential, parentEdge)) {
+        int pathCapacity = std::numeric_limits<int>::max();
+        for (int node = sink; node != source;
+             node = edges[parentEdge[node] ^ 1].to) {
+            pathCapacity =
+                std::min(pathCapacity, edges[parentEdge[node]].capacity);
+        }
+
+        std::int64_t unitCost = potential[sink] - potential[source];
+        if (unitCost > 0) {
+            std::int64_t affordable = (costLimit - result.cost) / unitCost;
+            pathCapacity = static_cast<int>(
+                std::min<std::int64_t>(pathCapacity, affordable));
+        }
+        if (pathCapacity <= 0) break;
+
+        for (int node = sink; node != source;
+             node = edges[parentEdge[node] ^ 1].to) {
+            edges[parentEdge[node]].capacity -= pathCapacity;
+            edges[parentEdge[node] ^ 1].capacity += pathCapacity;
+        }
+        result.flow += pathCapacity;
+        result.cost += unitCost * pathCapacity;
+    }
+    return result;
+}
+
+int MinCostFlow::getFlow(int edgeId) const {
+    return initialCapacity[edgeId] - edges[edgeId].capacity;
+}
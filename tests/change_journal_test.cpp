@@ -0,0 +1,116 @@
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryDir>
+
+#include "managers/change_journal.h"
+#include "managers/company_snapshot.h"
+#include "sample_company.h"
+
+namespace {
+
+// A saved sample company with an empty journal paired to its snapshot.
+struct SavedCompany {
+    QTemporaryDir dir;
+    QString snapshotFile = dir.filePath("company_1.snap");
+    QString journalFile = dir.filePath("company_1.journal");
+    Company company = makeSampleCompany();
+
+    SavedCompany() {
+        ChangeJournal::reset(journalFile,
+                             CompanySnapshot::save(company, snapshotFile));
+    }
+
+    // Journals whatever changed since the last call.
+    void appendChanges() {
+        ChangeJournal::append(
+            ChangeJournal::encode(company, company.getUnsavedChanges()),
+            journalFile);
+        company.clearUnsavedChanges();
+    }
+
+    Company reload() const {
+        Company loaded = CompanySnapshot::load(snapshotFile);
+        ChangeJournal::replay(loaded, journalFile,
+                              CompanySnapshot::readChecksum(snapshotFile));
+        loaded.normalizeLoadedData();
+        return loaded;
+    }
+};
+
+void hireTester(Company& company) {
+    company.addEmployee(std::make_shared<QA>(6, "Fay Tester", 3100.0,
+                                             "Quality", "Automated", 7));
+    company.assignEmployeeToTask(6, 1, 3, 20);
+}
+
+void replayAppliesChangesOverSnapshot() {
+    SavedCompany saved;
+    hireTester(saved.company);
+    saved.company.assignEmployeeToTask(2, 1, 1, 4);
+    saved.appendChanges();
+
+    saved.company.removeEmployee(3);
+    saved.company.addTaskToProject(2, Task(2, "Budget", "Management", 12, 1));
+    saved.appendChanges();
+    saved.company.recalculateAllHours();
+
+    Company loaded = saved.reload();
+    expectSameCompany(loaded, saved.company);
+    CHECK(!loaded.getEmployee(3));
+    CHECK_EQ(loaded.getEmployeeHours(6, 1, 3), 20);
+    CHECK_EQ(loaded.getProject(2)->getTasks().size(), size_t{2});
+}
+
+void tornRecordIsDropped() {
+    SavedCompany saved;
+    hireTester(saved.company);
+    saved.appendChanges();
+    Company beforeTornRecord = saved.reload();
+    qint64 intactSize = QFileInfo(saved.journalFile).size();
+
+    saved.company.removeEmployee(4);
+    saved.appendChanges();
+    qint64 fullSize = QFileInfo(saved.journalFile).size();
+    CHECK(QFile::resize(saved.journalFile, (intactSize + fullSize) / 2));
+
+    Company loaded = saved.reload();
+    expectSameCompany(loaded, beforeTornRecord);
+    CHECK(loaded.getEmployee(4) != nullptr);
+    CHECK(loaded.getEmployee(6) != nullptr);
+    CHECK_EQ(QFileInfo(saved.journalFile).size(), intactSize);
+}
+
+void journalOfStaleSnapshotIsIgnored() {
+    SavedCompany saved;
+    hireTester(saved.company);
+    saved.appendChanges();
+
+    // The snapshot is rewritten without resetting the journal, as a crash
+    // between the two writes would leave it.
+    Company rewritten = makeSampleCompany();
+    rewritten.removeEmployee(5);
+    rewritten.clearUnsavedChanges();
+    CompanySnapshot::save(rewritten, saved.snapshotFile);
+
+    Company loaded = saved.reload();
+    rewritten.recalculateAllHours();
+    expectSameCompany(loaded, rewritten);
+    CHECK(!loaded.getEmployee(6));
+
+    // The stale journal was replaced by an empty one for the new snapshot.
+    hireTester(loaded);
+    ChangeJournal::append(ChangeJournal::encode(loaded,
+                                                loaded.getUnsavedChanges()),
+                          saved.journalFile);
+    CHECK(saved.reload().getEmployee(6) != nullptr);
+}
+
+}  // namespace
+
+int main() {
+    return runTests({
+        {"replayAppliesChangesOverSnapshot", replayAppliesChangesOverSnapshot},
+        {"tornRecordIsDropped", tornRecordIsDropped},
+        {"journalOfStaleSnapshotIsIgnored", journalOfStaleSnapshotIsIgnored},
+    });
+}
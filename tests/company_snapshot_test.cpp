@@ -0,0 +1,85 @@
+#include <QFile>
+#include <QTemporaryDir>
+
+#include "managers/company_snapshot.h"
+#include "sample_company.h"
+
+namespace {
+
+void roundTripKeepsCompanyState() {
+    QTemporaryDir dir;
+    CHECK(dir.isValid());
+    QString fileName = dir.filePath("company_1.snap");
+
+    Company original = makeSampleCompany();
+    std::uint64_t checksum = CompanySnapshot::save(original, fileName);
+    CHECK_EQ(CompanySnapshot::readChecksum(fileName), checksum);
+
+    Company loaded = CompanySnapshot::load(fileName);
+    loaded.normalizeLoadedData();
+    expectSameCompany(loaded, original);
+
+    for (const auto& employee : original.getEmployeesView()) {
+        CHECK_EQ(loaded.getEmployee(employee->getId())->getCurrentWeeklyHours(),
+                 employee->getCurrentWeeklyHours());
+    }
+    for (const Project& project : original.getProjectsView()) {
+        CHECK_EQ(loaded.getProject(project.getId())->getAllocatedHours(),
+                 project.getAllocatedHours());
+    }
+}
+
+void headerLoadSkipsEmployeesAndProjects() {
+    QTemporaryDir dir;
+    QString fileName = dir.filePath("company_1.snap");
+    CompanySnapshot::save(makeSampleCompany(), fileName);
+
+    Company header = CompanySnapshot::loadHeader(fileName);
+    CHECK_EQ(header.getName(), QString("Acme"));
+    CHECK_EQ(header.getFoundedYear(), 2012);
+    CHECK(header.getEmployeesView().empty());
+    CHECK(header.getAllProjects().empty());
+}
+
+void corruptedSnapshotIsRejected() {
+    QTemporaryDir dir;
+    QString fileName = dir.filePath("company_1.snap");
+    CompanySnapshot::save(makeSampleCompany(), fileName);
+
+    QFile file(fileName);
+    CHECK(file.open(QIODevice::ReadWrite));
+    qint64 size = file.size();
+    file.seek(size - 1);
+    QByteArray last = file.read(1);
+    char flipped = static_cast<char>(last.constData()[0] ^ 0x5a);
+    file.seek(size - 1);
+    file.write(&flipped, 1);
+    file.close();
+
+    CHECK_THROWS(CompanySnapshot::load(fileName), FileManagerException);
+}
+
+void truncatedSnapshotIsRejected() {
+    QTemporaryDir dir;
+    QString fileName = dir.filePath("company_1.snap");
+    CompanySnapshot::save(makeSampleCompany(), fileName);
+
+    QFile file(fileName);
+    CHECK(file.open(QIODevice::ReadWrite));
+    file.resize(file.size() / 2);
+    file.close();
+
+    CHECK_THROWS(CompanySnapshot::load(fileName), FileManagerException);
+}
+
+}  // namespace
+
+int main() {
+    return runTests({
+        {"roundTripKeepsCompanyState", roundTripKeepsCompanyState},
+        {"headerLoadSkipsEmployeesAndProjects",
+         headerLoadSkipsEmployeesAndProjects},
+        {"corruptedSnapshotIsRejected", corruptedSnapshotIsRejected},
+        {"truncatedSnapshotIsRejected", truncatedSnapshotIsRejected},
+    });
+}
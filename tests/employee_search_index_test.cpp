@@ -0,0 +1,62 @@
+#include <algorithm>
+#include <vector>
+
+#include "entities/employee_search_index.h"
+#include "sample_company.h"
+
+namespace {
+
+std::vector<int> searchSorted(EmployeeSearchIndex& index, const QString& term) {
+    std::vector<int> matches = index.search(term);
+    std::ranges::sort(matches);
+    return matches;
+}
+
+void shortQueriesMatchAnySubstring() {
+    Company company = makeSampleCompany();
+    auto index = company.getEmployeeSearchIndex();
+
+    CHECK(searchSorted(*index, "ev") == std::vector<int>({2, 5}));
+    CHECK(searchSorted(*index, "q") == std::vector<int>({4}));
+    CHECK(searchSorted(*index, "zz").empty());
+
+    // Longer queries go through the trigram postings and agree with them.
+    CHECK(searchSorted(*index, "eve") == std::vector<int>({2, 5}));
+}
+
+void searchIgnoresCase() {
+    Company company = makeSampleCompany();
+    auto index = company.getEmployeeSearchIndex();
+
+    CHECK(searchSorted(*index, "BOB") == std::vector<int>({2}));
+    CHECK(searchSorted(*index, "aLiCe") == std::vector<int>({1}));
+    CHECK(searchSorted(*index, "Ca") == std::vector<int>({3}));
+    CHECK(searchSorted(*index, "ENGINEERING") == std::vector<int>({2, 5}));
+}
+
+void deletedEmployeesAreNotFound() {
+    Company company = makeSampleCompany();
+    auto index = company.getEmployeeSearchIndex();
+    CHECK(searchSorted(*index, "tester") == std::vector<int>({4}));
+
+    company.removeEmployee(4);
+    CHECK(searchSorted(*index, "tester").empty());
+    CHECK(searchSorted(*index, "da").empty());
+
+    // Removal before the postings exist is kept once they are built.
+    Company fresh = makeSampleCompany();
+    auto freshIndex = fresh.getEmployeeSearchIndex();
+    fresh.removeEmployee(2);
+    CHECK(searchSorted(*freshIndex, "bob").empty());
+    CHECK(searchSorted(*freshIndex, "developer") == std::vector<int>({5}));
+}
+
+}  // namespace
+
+int main() {
+    return runTests({
+        {"shortQueriesMatchAnySubstring", shortQueriesMatchAnySubstring},
+        {"searchIgnoresCase", searchIgnoresCase},
+        {"deletedEmployeesAreNotFound", deletedEmployeesAreNotFound},
+    });
+}
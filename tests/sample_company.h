@@ -0,0 +1,122 @@
+#pragma once
+
+#include <QDate>
+#include <QString>
+#include <memory>
+#include <span>
+
+#include "entities/company.h"
+#include "entities/derived_employees.h"
+#include "entities/project.h"
+#include "entities/task.h"
+#include "test_support.h"
+
+// One employee of every kind (one of them inactive), two projects with
+// tasks and a handful of assignments.
+inline Company makeSampleCompany() {
+    Company company("Acme", "Software", "Minsk", 2012);
+
+    company.addEmployee(
+        std::make_shared<Manager>(1, "Alice Manager", 5200.0, "Management", 1));
+    company.addEmployee(std::make_shared<Developer>(
+        2, "Bob Developer", 4100.5, "Engineering", "C++", 3.5, 0.75));
+    company.addEmployee(std::make_shared<Designer>(
+        3, "Carol Designer", 3600.0, "Design", "Figma", 12));
+    company.addEmployee(
+        std::make_shared<QA>(4, "Dan Tester", 3000.0, "Quality", "Manual", 42));
+    auto inactive = std::make_shared<Developer>(5, "Eve Former", 3900.0,
+                                                "Engineering", "Rust", 6.0);
+    inactive->setIsActive(false);
+    company.addEmployee(inactive);
+
+    const QString description = "Customer portal";
+    const QString phase = "Development";
+    const QString client = "Globex";
+    const QDate startDate(2026, 1, 12);
+    const QDate endDate(2026, 9, 30);
+    company.addProject(Project(ProjectParams{
+        1, "Portal", description, phase, startDate, endDate, 250000.0, client,
+        400}));
+    company.addTaskToProject(1, Task(1, "Backend", "Development", 160, 3));
+    company.addTaskToProject(1, Task(2, "Screens", "Design", 80, 2));
+    company.addTaskToProject(1, Task(3, "Regression", "QA", 60, 1));
+
+    const QString otherDescription = "Internal tooling";
+    const QString otherPhase = "Planning";
+    company.addProject(Project(ProjectParams{
+        2, "Tools", otherDescription, otherPhase, startDate, endDate, 90000.0,
+        client, 0}));
+    company.addTaskToProject(2, Task(1, "Roadmap", "Management", 20, 2));
+
+    company.restoreTaskAssignment(1, 2, 1, 10);
+    company.restoreTaskAssignment(2, 1, 1, 24);
+    company.restoreTaskAssignment(3, 1, 2, 16);
+    company.restoreTaskAssignment(4, 1, 3, 12);
+    company.restoreTaskAssignment(5, 1, 1, 8);
+
+    company.recalculateAllHours();
+    company.clearUnsavedChanges();
+    return company;
+}
+
+inline void expectSameEmployee(const Employee& actual,
+                               const Employee& expected) {
+    CHECK_EQ(actual.getId(), expected.getId());
+    CHECK_EQ(actual.getEmployeeType(), expected.getEmployeeType());
+    CHECK_EQ(actual.getName(), expected.getName());
+    CHECK_EQ(actual.getSalary(), expected.getSalary());
+    CHECK_EQ(actual.getDepartment(), expected.getDepartment());
+    CHECK_EQ(actual.getEmploymentRate(), expected.getEmploymentRate());
+    CHECK_EQ(actual.getIsActive(), expected.getIsActive());
+    CHECK_EQ(actual.getDetails(), expected.getDetails());
+}
+
+inline void expectSameProject(const Project& actual, const Project& expected) {
+    CHECK_EQ(actual.getId(), expected.getId());
+    CHECK_EQ(actual.getName(), expected.getName());
+    CHECK_EQ(actual.getDescription(), expected.getDescription());
+    CHECK_EQ(actual.getPhase(), expected.getPhase());
+    CHECK(actual.getStartDate() == expected.getStartDate());
+    CHECK(actual.getEndDate() == expected.getEndDate());
+    CHECK_EQ(actual.getBudget(), expected.getBudget());
+    CHECK_EQ(actual.getClientName(), expected.getClientName());
+    CHECK_EQ(actual.getInitialEstimatedHours(),
+             expected.getInitialEstimatedHours());
+
+    std::span<const Task> actualTasks = actual.getTasks();
+    std::span<const Task> expectedTasks = expected.getTasks();
+    CHECK_EQ(actualTasks.size(), expectedTasks.size());
+    for (size_t i = 0; i < expectedTasks.size(); ++i) {
+        CHECK_EQ(actualTasks[i].getId(), expectedTasks[i].getId());
+        CHECK_EQ(actualTasks[i].getName(), expectedTasks[i].getName());
+        CHECK_EQ(actualTasks[i].getType(), expectedTasks[i].getType());
+        CHECK_EQ(actualTasks[i].getEstimatedHours(),
+                 expectedTasks[i].getEstimatedHours());
+        CHECK_EQ(actualTasks[i].getPriority(), expectedTasks[i].getPriority());
+        CHECK_EQ(actualTasks[i].getPhase(), expectedTasks[i].getPhase());
+    }
+}
+
+// Compares everything a save persists, in container order.
+inline void expectSameCompany(const Company& actual, const Company& expected) {
+    CHECK_EQ(actual.getName(), expected.getName());
+    CHECK_EQ(actual.getIndustry(), expected.getIndustry());
+    CHECK_EQ(actual.getLocation(), expected.getLocation());
+    CHECK_EQ(actual.getFoundedYear(), expected.getFoundedYear());
+
+    auto actualEmployees = actual.getEmployeesView();
+    auto expectedEmployees = expected.getEmployeesView();
+    CHECK_EQ(actualEmployees.size(), expectedEmployees.size());
+    for (size_t i = 0; i < expectedEmployees.size(); ++i) {
+        expectSameEmployee(*actualEmployees[i], *expectedEmployees[i]);
+    }
+
+    auto actualProjects = actual.getAllProjects();
+    auto expectedProjects = expected.getAllProjects();
+    CHECK_EQ(actualProjects.size(), expectedProjects.size());
+    for (size_t i = 0; i < expectedProjects.size(); ++i) {
+        expectSameProject(actualProjects[i], expectedProjects[i]);
+    }
+
+    CHECK(actual.getAllTaskAssignments() == expected.getAllTaskAssignments());
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <QString>
+#include <cstdio>
+#include <exception>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "exceptions/exceptions.h"
+
+// A tiny runner: each test is a function that throws TestFailure through
+// CHECK/CHECK_EQ; runTests reports every case and returns the exit code.
+struct TestFailure {
+    std::string message;
+};
+
+template <typename T>
+std::string describeValue(const T& value) {
+    if constexpr (std::is_same_v<T, QString>) {
+        return '"' + value.toStdString() + '"';
+    } else if constexpr (std::is_same_v<T, bool>) {
+        return value ? "true" : "false";
+    } else if constexpr (std::is_arithmetic_v<T>) {
+        return std::to_string(value);
+    } else if constexpr (std::is_enum_v<T>) {
+        return std::to_string(static_cast<long long>(value));
+    } else {
+        return "<value>";
+    }
+}
+
+inline std::string failureLocation(const char* file, int line) {
+    return std::string(file) + ":" + std::to_string(line) + ": ";
+}
+
+#define CHECK(condition)                                              \
+    do {                                                              \
+        if (!(condition)) {                                           \
+            throw TestFailure{failureLocation(__FILE__, __LINE__) +   \
+                              "CHECK(" #condition ") failed"};        \
+        }                                                             \
+    } while (false)
+
+#define CHECK_EQ(actual, expected)                                        \
+    do {                                                                  \
+        const auto& actualValue = (actual);                               \
+        const auto& expectedValue = (expected);                           \
+        if (!(actualValue == expectedValue)) {                            \
+            throw TestFailure{failureLocation(__FILE__, __LINE__) +       \
+                              #actual " == " #expected ": got " +         \
+                              describeValue(actualValue) + ", expected " + \
+                              describeValue(expectedValue)};              \
+        }                                                                 \
+    } while (false)
+
+#define CHECK_THROWS(expression, ExceptionType)                         \
+    do {                                                                \
+        bool thrown = false;                                            \
+        try {                                                           \
+            (void)(expression);                                         \
+        } catch (const ExceptionType&) {                                \
+            thrown = true;                                              \
+        }                                                               \
+        if (!thrown) {                                                  \
+            throw TestFailure{failureLocation(__FILE__, __LINE__) +     \
+                              #expression " did not throw " #ExceptionType}; \
+        }                                                               \
+    } while (false)
+
+using TestCase = std::pair<const char*, void (*)()>;
+
+inline int runTests(std::initializer_list<TestCase> tests) {
+    int failures = 0;
+    for (const auto& [name, test] : tests) {
+        try {
+            test();
+            std::printf("PASS %s\n", name);
+        } catch (const TestFailure& failure) {
+            ++failures;
+            std::printf("FAIL %s\n  %s\n", name, failure.message.c_str());
+        } catch (const BaseException& e) {
+            ++failures;
+            std::printf("FAIL %s\n  unexpected exception: %s\n", name,
+                        e.getMessage().toStdString().c_str());
+        } catch (const std::exception& e) {
+            ++failures;
+            std::printf("FAIL %s\n  unexpected exception: %s\n", name,
+                        e.what());
+        }
+    }
+    std::printf("%d of %zu tests failed\n", failures, tests.size());
+    return failures == 0 ? 0 : 1;
+}